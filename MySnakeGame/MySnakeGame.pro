@@ -4,6 +4,9 @@ QT += core gui widgets
 # C++ Language Standard Configuration
 CONFIG += c++17
 
+# Let GCC/Clang Auto-Vectorize Hot Structure-Of-Arrays Loops At -O2
+gcc|clang: QMAKE_CXXFLAGS_RELEASE += -ftree-vectorize
+
 # Source Files To Be Compiled
 SOURCES += \
     gamescreen.cpp \
@@ -12,6 +15,19 @@ SOURCES += \
     home.cpp \
     mainHomeScreen.cpp \
     snake.cpp \
+    snakeactivity.cpp \
+    snakeautopilot.cpp \
+    snakeengine.cpp \
+    snakemap.cpp \
+    snakemapfields.cpp \
+    snakemcts.cpp \
+    snakeparticles.cpp \
+    snakerenderer.cpp \
+    snakereplay.cpp \
+    snakeresultoverlay.cpp \
+    snakesprites.cpp \
+    snakethreadpool.cpp \
+    snaketickscheduler.cpp \
     minesweeper.cpp \
     sudokuboard.cpp \
     sudokucontroller.cpp \
@@ -28,6 +44,27 @@ HEADERS += \
     homescreen.h \
     mainHomeScreen.h \
     snake.h \
+    snakeactivity.h \
+    snakeautopilot.h \
+    snakebits.h \
+    snakebody.h \
+    snakeengine.h \
+    snakefreecells.h \
+    snakehistogram.h \
+    snakeinputqueue.h \
+    snakemap.h \
+    snakemapfields.h \
+    snakemcts.h \
+    snakeparticles.h \
+    snakerandom.h \
+    snakerenderer.h \
+    snakereplay.h \
+    snakeresultoverlay.h \
+    snakesamplering.h \
+    snakesprites.h \
+    snakethreadpool.h \
+    snaketickscheduler.h \
+    snaketypes.h \
     minesweeper.h \
     sudokuboard.h \
     sudokucontroller.h \
@@ -1,9 +1,12 @@
 #include <QApplication>
 #include <QStackedWidget>
 #include <QDebug>
+#include <QFile>
+#include <QStandardPaths>
 #include "mainHomeScreen.h"
 #include "home.h"
 #include "snake.h"
+#include "snakemapfields.h"
 #include "minesweeper.h"
 #include "sudokucontroller.h"  // Add Sudoku controller header
 
@@ -29,6 +32,34 @@ int main(int argc, char *argv[])
     MainHomeScreen *mainHome = new MainHomeScreen();
     Home *snakeHome = new Home();
     Snake *snakeGame = new Snake();
+
+    // "--frame-stats FILE" Writes The Snake Frame Timing Samples As CSV On Exit
+    QStringList arguments = a.arguments();
+    int statsFlag = arguments.indexOf("--frame-stats");
+    if (statsFlag > 0 && statsFlag + 1 < arguments.size()) {
+        snakeGame->setFrameStatsExportPath(arguments.at(statsFlag + 1));
+    }
+
+    // "--map FILE [--map-cache DIR]" Plays A Level; Its Distance Fields Are Cached Per Map Hash
+    int mapFlag = arguments.indexOf("--map");
+    if (mapFlag > 0 && mapFlag + 1 < arguments.size()) {
+        auto map = std::make_shared<SnakeMap>();
+        if (SnakeMap::load(QFile::encodeName(arguments.at(mapFlag + 1)).toStdString(), *map)) {
+            int cacheFlag = arguments.indexOf("--map-cache");
+            QString cache = cacheFlag > 0 && cacheFlag + 1 < arguments.size()
+                                ? arguments.at(cacheFlag + 1)
+                                : QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/maps";
+            map->setFields(SnakeMapFields::loadOrBuild(QFile::encodeName(cache).toStdString(), *map));
+            snakeGame->setMap(map);
+        } else {
+            qWarning() << "Cannot load Snake map" << arguments.at(mapFlag + 1);
+        }
+    }
+
+    // "--ghost" Starts In Ghost Race Mode (Also Toggled With G)
+    if (arguments.contains("--ghost")) {
+        snakeGame->setGhostRace(true);
+    }
     MainWindow *minesweeperGame = new MainWindow();
     SudokuController *sudokuGame = new SudokuController();  // Create Sudoku game
 
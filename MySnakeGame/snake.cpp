@@ -2,17 +2,16 @@
 #include <QPainter>
 #include <QTimer>
 #include <QMessageBox>
-#include <QRandomGenerator>
-#include <QPushButton>
-#include <QVBoxLayout>
-#include <QLabel>
-#include <QGraphicsDropShadowEffect>
 #include <QPainterPath>
 #include <QFontDatabase>
 #include <QParallelAnimationGroup>
 #include <QApplication>
 #include <QDebug>
+#include <QFile>
+#include <QTextStream>
+#include <QtMath>
 #include <algorithm>
+#include <limits>
 #include "gamesizes.h"
 
 /**
@@ -21,6 +20,13 @@
  */
 Snake::Snake(QWidget *parent)
     : QWidget(parent)
+    , m_engine(20)
+    , m_nextDirection(SnakeDirection::Right)
+    , m_inputQueueDelay(500000, 512)
+    , m_inputLatency(500000, 512)
+    , m_autopilotKind(SnakeAutopilotKind::Hamiltonian)
+    , m_ghostRace(false)
+    , m_ghostEngine(20)
     , m_gameOver(false)
     , m_paused(false)
     , m_score(0)
@@ -28,7 +34,25 @@ Snake::Snake(QWidget *parent)
     , m_cellSize(GameSizes::snakeCellSize())
     , m_headScale(1.0)
     , m_shadowOffset(0)
+    , m_paintTimeNs(0)
+    , m_frameSamples(16384)
+    , m_loopNsSincePaint(0)
+    , m_ticksSincePaint(0)
+    , m_overlayVisible(false)
     , m_currentDifficulty(1)
+    , m_arenaSize(0)
+    , m_mapHash(0)
+    , m_resultOverlay(nullptr)
+    , m_resultRequestedNs(-1)
+    , m_resultLatencyNs(0)
+    , m_restartRequestedNs(-1)
+    , m_restartLatencyNs(0)
+    , m_lastFrameNs(0)
+    , m_nextFrameNs(0)
+    , m_tickIntervalMs(150)
+    , m_frameRate(qBound(30, qRound(QApplication::primaryScreen()->refreshRate()), 240))
+    , m_tickProgress(1.0)
+    , m_interpolate(false)
 {
     // Calculate optimal size based on screen
     QSize optimalSize = calculateOptimalSize();
@@ -37,11 +61,11 @@ Snake::Snake(QWidget *parent)
     setFocusPolicy(Qt::StrongFocus);
     setStyleSheet("background-color: transparent;");
 
-    // Initialize Visual Components
-    createGradientBackground();
-
-    // Setup Game Timer (don't start yet)
+    // Setup Render Loop Timer (don't start yet)
+    // Coarse Timers May Fire Up To 5% Late, So Use A Precise Single Shot Re-Armed Each Frame
     m_timer = new QTimer(this);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    m_timer->setSingleShot(true);
     connect(m_timer, &QTimer::timeout, this, &Snake::gameLoop);
 
     // Initialize Head Animation
@@ -60,31 +84,34 @@ Snake::Snake(QWidget *parent)
     m_shadowAnimation->setEndValue(GameSizes::snakeCellSize() / 6);
     m_shadowAnimation->setEasingCurve(QEasingCurve::OutQuad);
 
-    // Setup Particle Effects Timer
-    m_particleTimer = new QTimer(this);
-    m_particleTimer->setInterval(50);
-    connect(m_particleTimer, &QTimer::timeout, [this]() {
-        // Update Particle Positions
-        for (auto &particle : m_particles) {
-            particle.ry() += 2;
+    // Every Repaint Source Stops Together While Paused, Hidden Or Inactive
+    m_activity = new SnakeActivityRegistry(this);
+    m_activity->addTimer(m_timer);
+    m_activity->addAnimation(m_headAnimation);
+    m_activity->addAnimation(m_shadowAnimation);
+    connect(m_activity, &SnakeActivityRegistry::suspended, this, &Snake::suspendActivity);
+    connect(m_activity, &SnakeActivityRegistry::resumed, this, &Snake::resumeActivity);
+
+    // Result Panel Exists From The Start So It Rasterises While Idle, Not When A Game Ends
+    m_resultOverlay = new SnakeResultOverlay(this);
+    m_activity->addAnimation(m_resultOverlay->fadeAnimation());
+    connect(m_resultOverlay, &SnakeResultOverlay::restartRequested, this, [this]() {
+        initGame(m_currentDifficulty);
+    });
+    connect(m_resultOverlay, &SnakeResultOverlay::homeRequested, this, [this]() {
+        m_resultOverlay->dismiss();
+        hide();
+        emit backToHome();
+    });
+    connect(m_resultOverlay, &SnakeResultOverlay::presented, this, [this]() {
+        if (m_resultRequestedNs >= 0 && m_clock.isValid()) {
+            m_resultLatencyNs = m_clock.nsecsElapsed() - m_resultRequestedNs;
         }
-
-        // Remove Particles That Have Fallen Off Screen
-        m_particles.erase(
-            std::remove_if(m_particles.begin(), m_particles.end(),
-                           [this](const QPointF &p) { return p.y() > height(); }),
-            m_particles.end());
-        update();
+        m_resultRequestedNs = -1;
     });
 
-    // Initialize Snake Color Palette
-    for (int i = 0; i < 10; ++i) {
-        int hue = (i * 36) % 360;
-        m_snakeColors[i] = QColor::fromHsv(hue, 255, 200);
-    }
-
     // Initialize with default difficulty (but don't start game yet)
-    // We'll initialize when the widget is shown
+    // The screen switch that shows the widget calls initGame()
 }
 
 /**
@@ -95,19 +122,40 @@ Snake::~Snake()
     if (m_timer && m_timer->isActive()) {
         m_timer->stop();
     }
-    if (m_particleTimer && m_particleTimer->isActive()) {
-        m_particleTimer->stop();
+
+    if (!m_frameStatsPath.isEmpty()) {
+        exportFrameStats(m_frameStatsPath);
     }
 }
 
 /**
- * @brief Show event - called when widget is shown
+ * @brief Show event - continues whatever was running when the widget was hidden
  */
 void Snake::showEvent(QShowEvent *event)
 {
     QWidget::showEvent(event);
-    // Start the game when the widget is shown
-    initGame(m_currentDifficulty);
+    m_activity->setSuspended(SnakeActivityRegistry::Inactive, !isActiveWindow());
+    m_activity->resume(SnakeActivityRegistry::Hidden);
+}
+
+/**
+ * @brief Hide event - nothing ticks or animates until the widget is shown again
+ */
+void Snake::hideEvent(QHideEvent *event)
+{
+    QWidget::hideEvent(event);
+    m_activity->suspend(SnakeActivityRegistry::Hidden);
+}
+
+/**
+ * @brief Tracks Window Activation So A Background Window Stays Idle
+ */
+void Snake::changeEvent(QEvent *event)
+{
+    QWidget::changeEvent(event);
+    if (event->type() == QEvent::ActivationChange) {
+        m_activity->setSuspended(SnakeActivityRegistry::Inactive, !isActiveWindow());
+    }
 }
 
 /**
@@ -173,42 +221,15 @@ void Snake::calculateCellSize()
 
     m_cellSize = qMin(width(), height()) / m_gridSize;
 
-    // Ensure minimum cell size
+    // Ensure minimum cell size (a map's grid is fixed, so its cells shrink instead)
     int minCellSize = GameSizes::snakeCellSize();
-    if (m_cellSize < minCellSize) {
+    if (m_cellSize < minCellSize && !m_map) {
         m_cellSize = minCellSize;
         // Recalculate grid size if necessary
         m_gridSize = qMin(width(), height()) / m_cellSize;
     }
 }
 
-/**
- * @brief Creates The Gradient Background For The Game Area
- */
-void Snake::createGradientBackground()
-{
-    m_backgroundGradient = QLinearGradient(0, 0, width(), height());
-
-    // Color scheme based on difficulty
-    switch(m_currentDifficulty) {
-    case 0: // Easy - greens
-        m_backgroundGradient.setColorAt(0.0, QColor(20, 40, 30));
-        m_backgroundGradient.setColorAt(0.5, QColor(30, 50, 40));
-        m_backgroundGradient.setColorAt(1.0, QColor(20, 40, 30));
-        break;
-    case 1: // Medium - blues
-        m_backgroundGradient.setColorAt(0.0, QColor(20, 30, 40));
-        m_backgroundGradient.setColorAt(0.5, QColor(30, 40, 50));
-        m_backgroundGradient.setColorAt(1.0, QColor(20, 30, 40));
-        break;
-    case 2: // Hard - reds/purples
-        m_backgroundGradient.setColorAt(0.0, QColor(40, 20, 30));
-        m_backgroundGradient.setColorAt(0.5, QColor(50, 30, 40));
-        m_backgroundGradient.setColorAt(1.0, QColor(40, 20, 30));
-        break;
-    }
-}
-
 /**
  * @brief Initializes A New Game With Specified Difficulty
  * @param difficulty Difficulty Level (0 = Easy, 1 = Medium, 2 = Hard)
@@ -219,17 +240,28 @@ void Snake::initGame(int difficulty)
     if (m_timer && m_timer->isActive()) {
         m_timer->stop();
     }
-    if (m_particleTimer && m_particleTimer->isActive()) {
-        m_particleTimer->stop();
-    }
+
+    // Result Panel Is Hidden, Not Destroyed, So The Next Game Over Only Updates Its Text;
+    // Rebuilding Is Deferred Until Idle In Case The Window Moved To Another Screen
+    m_resultOverlay->dismiss();
+    QTimer::singleShot(0, m_resultOverlay, &SnakeResultOverlay::prepare);
+    m_restartRequestedNs = isVisible() && m_clock.isValid() ? m_clock.nsecsElapsed() : -1;
 
     m_currentDifficulty = difficulty;
 
-    // Update grid size based on difficulty
-    updateGridSizeForDifficulty();
+    if (m_arenaSize > 0) {
+        // Arena Keeps Readable Cells And Scrolls Instead Of Shrinking The Board
+        m_gridSize = m_arenaSize;
+        m_cellSize = GameSizes::snakeCellSize();
+    }
+    else {
+        // Update grid size based on difficulty, unless a map fixes it
+        updateGridSizeForDifficulty();
+        if (m_map) m_gridSize = m_map->gridSize();
 
-    // Calculate cell size
-    calculateCellSize();
+        // Calculate cell size
+        calculateCellSize();
+    }
 
     // Set Game Speed Based On Difficulty Level
     int speed;
@@ -247,33 +279,57 @@ void Snake::initGame(int difficulty)
         speed = 150;
     }
 
-    // Initialize Snake Starting Position (centered based on grid size)
-    int centerX = m_gridSize / 2;
-    int centerY = m_gridSize / 2;
-
-    m_snake.clear();
-    m_snake.append(QPoint(centerX, centerY));
-    m_snake.append(QPoint(centerX - 1, centerY));
-    m_snake.append(QPoint(centerX - 2, centerY));
+    // Reset Engine (snake centered based on grid size, or on the map's spawn, first food placed)
+    if (m_engine.map() != m_map.get()) m_engine.setMap(m_map);
+    quint64 mapHash = m_engine.map() ? m_mapHash : 0;
+
+    // Ghost Race: The Best Run Of This Board Starts Beside The Player From Its Own Seed, So Both
+    // See The Same First Food. Only The Input Log Is Kept; The Player Decodes It As Ticks Run
+    m_ghostPlayer.reset();
+    if (m_ghostRace && readReplayFile(bestReplayPath(), m_ghostReplay)
+        && m_ghostReplay.gridSize == m_gridSize && m_ghostReplay.mapHash == mapHash) {
+        if (m_ghostEngine.map() != m_map.get()) m_ghostEngine.setMap(m_map);
+        m_ghostPlayer = std::make_unique<SnakeReplayPlayer>(m_ghostReplay);
+        m_ghostPlayer->start(m_ghostEngine);
+        m_engine.reset(m_gridSize, m_ghostReplay.seed);
+    }
+    else {
+        m_engine.reset(m_gridSize);
+    }
+    updateCamera(0, true);
+    m_recorder.begin(m_engine.seed(), difficulty, m_gridSize, mapHash);
 
     // Reset Game State
-    m_direction = QPoint(1, 0);
-    m_nextDirection = QPoint(1, 0);
+    m_nextDirection = m_engine.direction();
+    m_inputQueue.clear();
+    m_shownInputs.clear();
+    m_inputQueueDelay.clear();
+    m_inputLatency.clear();
     m_score = 0;
     m_gameOver = false;
     m_paused = false;
     m_particles.clear();
 
-    // Update gradient for new difficulty
-    createGradientBackground();
+    // Celebrate first food
+    spawnFoodParticles();
+
+    // Reset Fixed Timestep Clock
+    m_tickIntervalMs = speed;
+    m_tickProgress = 1.0;
+    m_interpolate = false;
+    m_activity->resume(SnakeActivityRegistry::Paused);
+    restartClock();
+    m_scheduler.start(m_lastFrameNs, qint64(m_tickIntervalMs) * 1000000);
 
-    // Spawn first food
-    spawnFood();
+    // A Game Started While Hidden Or Inactive Waits Frozen At Tick 0 Until resumeActivity()
+    if (m_activity->isSuspended()) {
+        m_scheduler.pause(m_lastFrameNs);
+    }
 
     // Start Game Components
     updateScore(0);
-    m_timer->start(speed);
-    m_headAnimation->start();
+    startRenderLoop();
+    m_activity->start(m_headAnimation);
 
     emit gameStarted();
     update();
@@ -285,9 +341,8 @@ void Snake::initGame(int difficulty)
 void Snake::pauseGame()
 {
     if (!m_paused && !m_gameOver) {
-        if (m_timer) m_timer->stop();
-        if (m_particleTimer) m_particleTimer->stop();
         m_paused = true;
+        m_activity->suspend(SnakeActivityRegistry::Paused);
         emit gamePaused();
         update();
     }
@@ -299,14 +354,78 @@ void Snake::pauseGame()
 void Snake::resumeGame()
 {
     if (m_paused && !m_gameOver) {
-        if (m_timer) m_timer->start();
-        if (m_particleTimer) m_particleTimer->start();
         m_paused = false;
+        m_activity->resume(SnakeActivityRegistry::Paused);
         emit gameResumed();
         update();
     }
 }
 
+/**
+ * @brief Sets The Fixed Simulation Timestep
+ * @param milliseconds Time Between Engine Ticks
+ */
+void Snake::setTickInterval(int milliseconds)
+{
+    m_tickIntervalMs = qMax(1, milliseconds);
+    if (m_clock.isValid()) {
+        m_scheduler.setInterval(m_clock.nsecsElapsed(), qint64(m_tickIntervalMs) * 1000000);
+    }
+}
+
+/**
+ * @brief Sets The Render Loop Rate, Independent Of The Tick Rate
+ * @param framesPerSecond Target Frames Per Second
+ */
+void Snake::setFrameRate(int framesPerSecond)
+{
+    m_frameRate = qBound(1, framesPerSecond, 240);
+}
+
+/**
+ * @brief Re-Anchors The Frame Clock At The Current Time
+ */
+void Snake::restartClock()
+{
+    if (!m_clock.isValid()) {
+        m_clock.start();
+    }
+    m_lastFrameNs = m_clock.nsecsElapsed();
+}
+
+/**
+ * @brief Runs A Frame Right Away; gameLoop() Keeps The Loop Going From There
+ */
+void Snake::startRenderLoop()
+{
+    if (m_activity->isSuspended()) return;
+    m_nextFrameNs = m_clock.nsecsElapsed();
+    if (m_timer) m_timer->start(0);
+}
+
+/**
+ * @brief Arms The Single Shot Timer For The Next Wake-Up
+ *
+ * Frame deadlines advance by the exact frame period in nanoseconds rather
+ * than by a rounded millisecond interval, so the frame rate does not drift;
+ * a frame that fell more than a period behind re-anchors instead of
+ * bunching. Waking for a tick deadline that falls between frames lets the
+ * tick run on time instead of on the next frame boundary.
+ */
+void Snake::scheduleNextFrame(qint64 now)
+{
+    if (m_gameOver || m_paused || m_activity->isSuspended()) return;
+
+    const qint64 framePeriodNs = 1000000000LL / m_frameRate;
+    if (m_nextFrameNs <= now) {
+        m_nextFrameNs += framePeriodNs;
+        if (m_nextFrameNs <= now) m_nextFrameNs = now + framePeriodNs;
+    }
+
+    qint64 wakeNs = qMin(m_nextFrameNs, m_scheduler.nextDeadlineNs());
+    m_timer->start(int(qMax<qint64>(0, (wakeNs - now + 999999) / 1000000)));
+}
+
 /**
  * @brief Changes Game Difficulty During Runtime
  * @param difficulty New Difficulty Level
@@ -327,142 +446,473 @@ void Snake::setDifficulty(int difficulty)
     default: speed = 150;
     }
 
-    if (!m_gameOver && !m_paused && m_timer) {
-        m_timer->setInterval(speed);
-    }
+    setTickInterval(speed);
 
-    // Update gradient
-    createGradientBackground();
+    // Background Colours Follow The Difficulty On The Next Paint
     update();
 }
 
 /**
- * @brief Spawns Food At A Random Valid Position On The Grid
+ * @brief Emits A Particle Burst Centered On The Current Food
  */
-void Snake::spawnFood()
+void Snake::spawnFoodParticles()
 {
-    if (m_gridSize <= 0) return;
+    if (!m_engine.hasFood()) return;
 
-    int maxX = m_gridSize - 1;
-    int maxY = m_gridSize - 1;
+    SnakeCell food = m_engine.food();
 
-    if (maxX <= 0 || maxY <= 0) return;
+    // Create Particle Effect For New Food (pool storage, no allocation)
+    int particleCount = qBound(5, m_cellSize / 5, 12);
+    m_particles.spawnBurst(food.x * m_cellSize + m_cellSize/2,
+                           food.y * m_cellSize + m_cellSize/2,
+                           particleCount, m_cellSize * 3.0f);
+}
+
+/**
+ * @brief Advances The Engine One Tick And Reacts To The Outcome
+ */
+void Snake::moveSnake()
+{
+    if (m_gameOver || m_paused) return;
+
+    if (m_autopilot) {
+        m_nextDirection = m_autopilot->decide(m_engine);
+    }
+    else if (!m_inputQueue.isEmpty()) {
+        // Apply The Oldest Pending Turn; Its Latency Is Closed Off By The Next Paint
+        SnakeInput input = m_inputQueue.pop();
+        m_nextDirection = input.direction;
+        m_inputQueueDelay.record(m_clock.nsecsElapsed() - input.timestampNs);
+        m_shownInputs.append(input.timestampNs);
+    }
 
-    // Check if snake fills the entire grid (win condition)
-    if (m_snake.size() >= m_gridSize * m_gridSize) {
-        // Player wins!
+    m_recorder.record(m_engine.tickCount() + 1, m_nextDirection);
+    SnakeStepResult result = m_engine.step(m_nextDirection);
+    m_interpolate = result == SnakeStepResult::Moved || result == SnakeStepResult::Ate;
+
+    // Ghost Advances Exactly One Recorded Tick Per Live Tick
+    if (isGhostVisible()) {
+        m_ghostPlayer->step(m_ghostEngine);
+    }
+
+    switch (result) {
+    case SnakeStepResult::Ate:
+        // Handle Food Collision
+        updateScore(m_engine.score());
+        spawnFoodParticles();
+        m_activity->start(m_headAnimation);
+        m_activity->start(m_shadowAnimation);
+        break;
+
+    case SnakeStepResult::Won:
+        // Player Filled The Grid
+        updateScore(m_engine.score());
         m_timer->stop();
-        m_particleTimer->stop();
         m_gameOver = true;
+        m_resultRequestedNs = m_clock.nsecsElapsed();
+        saveReplay();
         showWinDialog();
-        return;
+        break;
+
+    case SnakeStepResult::HitWall:
+    case SnakeStepResult::HitSelf:
+        m_timer->stop();
+        m_gameOver = true;
+        m_resultRequestedNs = m_clock.nsecsElapsed();
+        saveReplay();
+        showGameOverDialog();
+        emit gameOver(m_score);
+        update();
+        break;
+
+    default:
+        break;
     }
+}
+
+/**
+ * @brief Finishes The Recording And Writes It Next To The Score Files
+ */
+void Snake::saveReplay()
+{
+    m_recorder.finish(m_engine);
+    const SnakeReplay &replay = m_recorder.replay();
+    writeReplayFile("last_snake_replay.snkr", replay);
+
+    // Ghost Races Load The Best Run, So Only A Higher Score Replaces It
+    QString bestPath = bestReplayPath();
+    SnakeReplay best;
+    if (!readReplayFile(bestPath, best) || replay.finalScore > best.finalScore) {
+        writeReplayFile(bestPath, replay);
+    }
+}
+
+/**
+ * @brief Best Run File For The Current Difficulty, Grid Size And Map
+ */
+QString Snake::bestReplayPath() const
+{
+    quint64 mapHash = m_engine.map() ? m_mapHash : 0;
+    return QString("best_snake_replay_%1_%2_%3.snkr")
+        .arg(m_currentDifficulty)
+        .arg(m_gridSize)
+        .arg(mapHash, 16, 16, QChar('0'));
+}
 
-    // Find Valid Position Not Occupied By Snake
-    int attempts = 0;
-    bool validPosition = false;
+/**
+ * @brief Reads And Decodes A Replay File
+ */
+bool Snake::readReplayFile(const QString &path, SnakeReplay &replay)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+    QByteArray bytes = file.readAll();
+    return SnakeReplay::deserialize(reinterpret_cast<const std::uint8_t *>(bytes.constData()),
+                                    static_cast<std::size_t>(bytes.size()), replay);
+}
 
-    while (!validPosition && attempts < 1000) {
-        int x = QRandomGenerator::global()->bounded(0, maxX + 1);
-        int y = QRandomGenerator::global()->bounded(0, maxY + 1);
-        m_food = QPoint(x, y);
+/**
+ * @brief Serializes A Replay Into A File
+ */
+bool Snake::writeReplayFile(const QString &path, const SnakeReplay &replay)
+{
+    std::vector<std::uint8_t> bytes = replay.serialize();
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) return false;
+    return file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<qint64>(bytes.size()))
+           == static_cast<qint64>(bytes.size());
+}
 
-        if (!m_snake.contains(m_food)) {
-            validPosition = true;
+/**
+ * @brief Render Loop Called At Display Rate And At Tick Deadlines
+ *
+ * Simulation ticks fall due on SnakeTickScheduler's fixed grid of deadlines
+ * measured on a monotonic clock; the fraction of the next tick already
+ * elapsed drives interpolation so motion stays smooth whatever the frame rate.
+ */
+void Snake::gameLoop()
+{
+    if (m_gameOver || m_paused) return;
+
+    qint64 now = m_clock.nsecsElapsed();
+    qint64 frameNs = now - m_lastFrameNs;
+    m_lastFrameNs = now;
+
+    // Step Particles On The Same Frame Clock (Particles Live In World Pixels)
+    m_particles.update(frameNs / 1e9f, m_camera.y() + height());
+
+    // Run Every Tick That Fell Due Since The Last Frame
+    SnakeTickFrame frame = m_scheduler.advance(now);
+    bool ghostWasVisible = isGhostVisible();
+    int ticksRun = 0;
+    while (ticksRun < frame.ticks && !m_gameOver) {
+        moveSnake();
+        ++ticksRun;
+    }
+
+    // Collect Cells The Engine Changed (head, old head, vacated tail, new food), And The Ghost's
+    QRegion dirty;
+    if (ticksRun > 0) {
+        for (int i = 0; i < m_engine.changedCellCount(); ++i) {
+            dirty += cellRect(m_engine.changedCell(i));
+        }
+        if (ghostWasVisible) {
+            for (int i = 0; i < m_ghostEngine.changedCellCount(); ++i) {
+                dirty += cellRect(m_ghostEngine.changedCell(i));
+            }
         }
-        attempts++;
     }
+    bool ghostVanished = ghostWasVisible && !isGhostVisible();
 
-    // If no valid position found after many attempts, game is won
-    if (!validPosition) {
-        m_timer->stop();
-        m_particleTimer->stop();
-        m_gameOver = true;
-        showWinDialog();
-        return;
+    // Extra Ticks In One Frame Ran Late, Whatever Is Still Owed After A Stall Was Dropped
+    if (frame.late > 0 || frame.dropped > 0) {
+        emit tickTimingIssue(frame.late, frame.dropped);
     }
 
-    // Create Particle Effect For New Food
-    int particleCount = qBound(5, m_cellSize / 5, 12);
-    for (int i = 0; i < particleCount; ++i) {
-        m_particles.append(QPointF(
-            m_food.x() * m_cellSize + m_cellSize/2,
-            m_food.y() * m_cellSize + m_cellSize/2
-            ));
+    m_tickProgress = m_gameOver ? 1.0 : qBound(0.0, frame.progress, 1.0);
+    scheduleNextFrame(now);
+
+    // Scrolling Arena Redraws The Viewport Every Frame; Its Cost Is Bounded By The Viewport
+    if (m_arenaSize > 0) {
+        updateCamera(frameNs / 1e9);
+        update();
     }
-    if (!m_particleTimer->isActive()) {
-        m_particleTimer->start();
+    // Repaint Only What Moved: Previous And Current Dynamic Areas Plus Changed Cells
+    else if (m_gameOver || ticksRun > 1 || frame.dropped > 0 || ghostVanished) {
+        update();
+        m_lastDynamicRegion = dynamicRegion();
+    }
+    else {
+        QRegion current = dynamicRegion();
+        update(dirty + current + m_lastDynamicRegion);
+        m_lastDynamicRegion = current;
     }
+
+    // Attributed To The Next Painted Frame
+    m_loopNsSincePaint += m_clock.nsecsElapsed() - now;
+    m_ticksSincePaint += ticksRun;
 }
 
 /**
- * @brief Moves The Snake In The Current Direction
+ * @brief Widget Rectangle Of A Grid Cell
  */
-void Snake::moveSnake()
+QRect Snake::cellRect(SnakeCell cell) const
 {
-    if (m_gameOver || m_paused || m_snake.isEmpty()) return;
+    QPoint origin = m_camera.toPoint();
+    return QRect(cell.x * m_cellSize - origin.x(), cell.y * m_cellSize - origin.y(), m_cellSize, m_cellSize);
+}
 
-    // Update Direction If Valid (Prevent Reversing)
-    if (m_nextDirection != -m_direction && m_nextDirection != QPoint(0,0)) {
-        m_direction = m_nextDirection;
+/**
+ * @brief Moves The Arena Camera Toward The Interpolated Head, Clamped To The World
+ * @param frameSeconds Time Since The Previous Frame
+ * @param snap Jump Straight To The Target (New Game)
+ */
+void Snake::updateCamera(qreal frameSeconds, bool snap)
+{
+    if (m_arenaSize <= 0) {
+        m_camera = QPointF();
+        return;
     }
 
-    // Add New Head Position
-    QPoint newHead = m_snake.first() + m_direction;
-    m_snake.prepend(newHead);
+    SnakeCell head = m_engine.head();
+    SnakeCell from = m_engine.length() > 1 ? m_engine.segment(1) : head;
+    qreal alpha = m_interpolate ? m_tickProgress : 1.0;
+    QPointF headCentre((from.x + (head.x - from.x) * alpha + 0.5) * m_cellSize,
+                       (from.y + (head.y - from.y) * alpha + 0.5) * m_cellSize);
 
-    // Handle Food Collision
-    if (newHead == m_food) {
-        updateScore(m_score + 1);
-        spawnFood();
-        m_headAnimation->start();
-        m_shadowAnimation->start();
-    } else {
-        m_snake.removeLast();
-    }
+    qreal worldSize = qreal(m_gridSize) * m_cellSize;
+    QPointF target(qBound(0.0, headCentre.x() - width() / 2.0, qMax(0.0, worldSize - width())),
+                   qBound(0.0, headCentre.y() - height() / 2.0, qMax(0.0, worldSize - height())));
 
-    // Check For Collision After Movement
-    if (checkCollision()) {
-        m_timer->stop();
-        m_particleTimer->stop();
-        m_gameOver = true;
-        showGameOverDialog();
-        emit gameOver(m_score);
-        update();
+    // Exponential Follow, Frame Rate Independent
+    qreal follow = snap ? 1.0 : 1.0 - qExp(-8.0 * frameSeconds);
+    m_camera += (target - m_camera) * follow;
+}
+
+/**
+ * @brief Switches Between The Normal Board And A Scrolling Large Arena
+ * @param gridSize Arena Grid Size In Cells, 0 For The Difficulty Sized Board
+ */
+void Snake::setArenaSize(int gridSize)
+{
+    m_arenaSize = gridSize > 0 ? qBound(32, gridSize, SnakeEngine::MaxGridSize) : 0;
+    m_map.reset();
+    m_mapHash = 0;
+    disableAutopilot();
+    initGame(m_currentDifficulty);
+}
+
+/**
+ * @brief Turns Racing Against The Best Recorded Run On Or Off
+ */
+void Snake::setGhostRace(bool enabled)
+{
+    if (m_ghostRace == enabled) return;
+    m_ghostRace = enabled;
+    initGame(m_currentDifficulty);
+}
+
+/**
+ * @brief Switches To A Level Map Or Back To The Open Board
+ * @param map Valid Level, Shared With The Engine; nullptr For The Open Board
+ */
+void Snake::setMap(std::shared_ptr<const SnakeMap> map)
+{
+    m_map = map && map->isValid() ? std::move(map) : nullptr;
+    m_mapHash = m_map ? m_map->hash() : 0;
+
+    // Boards Top Out At 30 Cells, Anything Larger Scrolls
+    m_arenaSize = m_map && m_map->gridSize() > 30 ? m_map->gridSize() : 0;
+    disableAutopilot();
+    initGame(m_currentDifficulty);
+}
+
+/**
+ * @brief Area Swept By The Head Sliding Into Its Cell, Including The Pulse Animation
+ */
+QRect Snake::headArea() const
+{
+    QRect area = cellRect(m_engine.head());
+    if (m_engine.length() > 1) {
+        area |= cellRect(m_engine.segment(1));
     }
+    int grow = qCeil(m_cellSize * qMax(0.0f, m_headScale - 1.0f) / 2) + 1;
+    return area.adjusted(-grow, -grow, grow, grow);
 }
 
 /**
- * @brief Checks For Wall And Self Collision
- * @return true If Collision Detected, false Otherwise
+ * @brief Area Swept By The Tail Sliding Out Of The Cell It Vacated
  */
-bool Snake::checkCollision()
+QRect Snake::tailArea() const
 {
-    if (m_snake.isEmpty()) return true;
+    return (cellRect(m_engine.tail()) | cellRect(m_engine.previousTail())).adjusted(-1, -1, 1, 1);
+}
 
-    QPoint head = m_snake.first();
+/**
+ * @brief Ghost Head And Tail Slide Like The Live Snake's; Its Body Only Changes On Ticks
+ */
+QRegion Snake::ghostArea() const
+{
+    if (!isGhostVisible() || m_ghostEngine.length() == 0) return QRegion();
 
-    // Check Wall Collision
-    if (head.x() < 0 || head.x() >= m_gridSize ||
-        head.y() < 0 || head.y() >= m_gridSize) {
-        return true;
+    QRect head = cellRect(m_ghostEngine.head());
+    if (m_ghostEngine.length() > 1) {
+        head |= cellRect(m_ghostEngine.segment(1));
     }
+    QRect tail = cellRect(m_ghostEngine.tail()) | cellRect(m_ghostEngine.previousTail());
+    return QRegion(head.adjusted(-1, -1, 1, 1)) + tail.adjusted(-1, -1, 1, 1);
+}
 
-    // Check Self Collision (skip head at index 0)
-    for (int i = 1; i < m_snake.size(); ++i) {
-        if (m_snake[i] == head) return true;
+/**
+ * @brief Food Cell Plus The Animated Drop Shadow
+ */
+QRect Snake::foodArea() const
+{
+    if (!m_engine.hasFood()) return QRect();
+    return cellRect(m_engine.food()).adjusted(0, 0, m_cellSize / 2, m_cellSize / 2);
+}
+
+/**
+ * @brief Bounding Box Of All Live Particles
+ */
+QRect Snake::particleArea() const
+{
+    float left, top, right, bottom;
+    if (!m_particles.bounds(left, top, right, bottom)) return QRect();
+
+    int radius = qBound(2, m_cellSize / 8, 4) + 1;
+    return QRectF(QPointF(left, top), QPointF(right, bottom)).toAlignedRect()
+        .adjusted(-radius, -radius, radius, radius);
+}
+
+/**
+ * @brief HUD Rectangle Holding The Score Text
+ */
+QRect Snake::scoreArea() const
+{
+    return SnakeRenderer::scoreArea(size());
+}
+
+/**
+ * @brief Everything The Dynamic Layer Draws That Can Change Between Frames
+ */
+QRegion Snake::dynamicRegion() const
+{
+    QRegion region;
+    region += headArea();
+    region += tailArea();
+    region += foodArea();
+    region += particleArea();
+    region += scoreArea();
+    region += ghostArea();
+    if (m_overlayVisible) {
+        region += overlayArea();
     }
+    return region;
+}
 
-    return false;
+/**
+ * @brief Top Left Panel Used By The Performance Overlay
+ */
+QRect Snake::overlayArea() const
+{
+    return QRect(8, 8, 240, 170);
 }
 
 /**
- * @brief Main Game Loop Called By Timer
+ * @brief Shows Or Hides The Performance Overlay
  */
-void Snake::gameLoop()
+void Snake::setOverlayVisible(bool visible)
 {
-    moveSnake();
-    update();
+    if (m_overlayVisible == visible) return;
+    m_overlayVisible = visible;
+    update(overlayArea());
+}
+
+/**
+ * @brief Draws Frame Timing, Tick Lateness And Particle Count
+ *
+ * Averages cover the last second of samples from the frame ring; the bars
+ * are the tick lateness histogram for 0-8 ms in 0.25 ms buckets.
+ */
+void Snake::drawOverlay(QPainter &painter)
+{
+    const int window = 240;
+    SnakeFrameSample samples[window];
+    int count = m_frameSamples.copyLatest(samples, window);
+
+    qint64 newestNs = count ? samples[count - 1].timestampNs : 0;
+    int frames = 0;
+    qint64 paintSum = 0, paintMax = 0, loopSum = 0, loopMax = 0;
+    for (int i = count - 1; i >= 0 && newestNs - samples[i].timestampNs < 1000000000LL; --i) {
+        ++frames;
+        paintSum += samples[i].paintNs;
+        paintMax = qMax<qint64>(paintMax, samples[i].paintNs);
+        loopSum += samples[i].loopNs;
+        loopMax = qMax<qint64>(loopMax, samples[i].loopNs);
+    }
+    int averaged = qMax(1, frames);
+    const SnakeHistogram &lateness = m_scheduler.lateness();
+
+    QRect panel = overlayArea();
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(0, 0, 0, 170));
+    painter.drawRoundedRect(panel, 6, 6);
+
+    painter.setPen(QColor(220, 255, 220));
+    painter.setFont(QFont("Monospace", 9));
+    QStringList lines;
+    lines << QString("fps   %1").arg(frames)
+          << QString("paint %1 ms  max %2").arg(paintSum / averaged / 1e6, 0, 'f', 2).arg(paintMax / 1e6, 0, 'f', 2)
+          << QString("loop  %1 ms  max %2").arg(loopSum / averaged / 1e6, 0, 'f', 2).arg(loopMax / 1e6, 0, 'f', 2)
+          << QString("tick  late p50 %1  p99 %2 ms").arg(lateness.percentileNs(0.5) / 1e6, 0, 'f', 2)
+                                                       .arg(lateness.percentileNs(0.99) / 1e6, 0, 'f', 2)
+          << QString("parts %1").arg(m_particles.count())
+          << QString("wake  %1  idle %2").arg(m_activity->wakeups()).arg(m_activity->idleWakeups())
+          << QString("over  %1 ms  restart %2 ms").arg(m_resultLatencyNs / 1e6, 0, 'f', 1)
+                                                   .arg(m_restartLatencyNs / 1e6, 0, 'f', 1);
+    painter.drawText(panel.adjusted(8, 6, -8, -50), Qt::AlignLeft | Qt::AlignTop, lines.join('\n'));
+
+    // Tick Lateness Histogram, Bars Scaled To The Tallest Bucket
+    const int buckets = 32;
+    QRect chart = panel.adjusted(8, panel.height() - 44, -8, -8);
+    quint64 tallest = 1;
+    for (int i = 0; i < buckets; ++i) {
+        tallest = qMax<quint64>(tallest, lateness.bucket(i));
+    }
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(46, 204, 113));
+    qreal barWidth = qreal(chart.width()) / buckets;
+    for (int i = 0; i < buckets; ++i) {
+        qreal barHeight = chart.height() * qreal(lateness.bucket(i)) / tallest;
+        painter.drawRect(QRectF(chart.left() + i * barWidth, chart.bottom() - barHeight, barWidth - 1, barHeight));
+    }
+}
+
+/**
+ * @brief Writes Every Buffered Frame Sample As CSV
+ * @param path Output File
+ */
+bool Snake::exportFrameStats(const QString &path) const
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+
+    QVector<SnakeFrameSample> samples(m_frameSamples.capacity());
+    int count = m_frameSamples.copyLatest(samples.data(), samples.size());
+
+    QTextStream out(&file);
+    out << "timestamp_ms,paint_us,loop_us,ticks,particles\n";
+    for (int i = 0; i < count; ++i) {
+        const SnakeFrameSample &sample = samples[i];
+        out << QString::number(sample.timestampNs / 1e6, 'f', 3) << ','
+            << QString::number(sample.paintNs / 1e3, 'f', 1) << ','
+            << QString::number(sample.loopNs / 1e3, 'f', 1) << ','
+            << sample.ticks << ',' << sample.particles << '\n';
+    }
+    return true;
 }
 
 /**
@@ -473,6 +923,56 @@ void Snake::animateHead()
     m_headScale = 1.0;
 }
 
+/**
+ * @brief Freezes The Tick Schedule Once The Registry Has Stopped The Timer And Animations
+ */
+void Snake::suspendActivity()
+{
+    if (m_clock.isValid()) {
+        m_scheduler.pause(m_clock.nsecsElapsed());
+    }
+}
+
+/**
+ * @brief Picks The Game Up Where It Stopped, Without Charging The Idle Time As Ticks
+ */
+void Snake::resumeActivity()
+{
+    if (!m_clock.isValid() || m_gameOver || m_paused) return;
+
+    restartClock();
+    m_scheduler.resume(m_lastFrameNs);
+    startRenderLoop();
+    update();
+}
+
+/**
+ * @brief Lets A Strategy Steer The Snake From The Next Tick On
+ * @param kind Strategy To Use
+ */
+void Snake::setAutopilot(SnakeAutopilotKind kind)
+{
+    // Every Strategy Rebuilds Whole-Grid Search State Each Tick, Which A Scrolling Arena Of Up
+    // To 4096 x 4096 Cells Cannot Afford On The GUI Thread; Arenas Are Always Steered By Hand
+    if (m_arenaSize > 0) {
+        disableAutopilot();
+        return;
+    }
+
+    m_autopilot = createSnakeStrategy(kind);
+    m_autopilotKind = kind;
+    m_inputQueue.clear();
+}
+
+/**
+ * @brief Returns Steering To The Keyboard
+ */
+void Snake::disableAutopilot()
+{
+    if (!m_autopilot) return;
+    m_autopilot.reset();
+}
+
 /**
  * @brief Handles Keyboard Input For Game Control
  * @param event Key Press Event
@@ -489,18 +989,62 @@ void Snake::keyPressEvent(QKeyEvent *event)
         return;
     }
 
-    // Set Next Direction Based On Key Press
-    if (event->key() == Qt::Key_Up && m_direction != QPoint(0, 1)) {
-        m_nextDirection = QPoint(0, -1);
+    // Any Arrow Key Takes Steering Back From The Autopilot
+    switch (event->key()) {
+    case Qt::Key_Up:
+    case Qt::Key_Down:
+    case Qt::Key_Left:
+    case Qt::Key_Right:
+        disableAutopilot();
+        break;
+    default:
+        break;
+    }
+
+    // Queue Turns With Their Arrival Time; The Queue Rejects Reversals Of The Last Queued Turn
+    qint64 now = m_clock.isValid() ? m_clock.nsecsElapsed() : 0;
+    SnakeDirection current = m_engine.direction();
+    if (event->key() == Qt::Key_Up) {
+        m_inputQueue.push(SnakeDirection::Up, now, current);
     }
-    else if (event->key() == Qt::Key_Down && m_direction != QPoint(0, -1)) {
-        m_nextDirection = QPoint(0, 1);
+    else if (event->key() == Qt::Key_Down) {
+        m_inputQueue.push(SnakeDirection::Down, now, current);
     }
-    else if (event->key() == Qt::Key_Left && m_direction != QPoint(1, 0)) {
-        m_nextDirection = QPoint(-1, 0);
+    else if (event->key() == Qt::Key_Left) {
+        m_inputQueue.push(SnakeDirection::Left, now, current);
     }
-    else if (event->key() == Qt::Key_Right && m_direction != QPoint(-1, 0)) {
-        m_nextDirection = QPoint(1, 0);
+    else if (event->key() == Qt::Key_Right) {
+        m_inputQueue.push(SnakeDirection::Right, now, current);
+    }
+    else if (event->key() == Qt::Key_A) {
+        // Cycle Off -> Greedy BFS -> A* -> Hamiltonian -> MCTS -> Off
+        if (!m_autopilot) {
+            setAutopilot(SnakeAutopilotKind::GreedyBfs);
+        }
+        else if (m_autopilotKind == SnakeAutopilotKind::GreedyBfs) {
+            setAutopilot(SnakeAutopilotKind::AStar);
+        }
+        else if (m_autopilotKind == SnakeAutopilotKind::AStar) {
+            setAutopilot(SnakeAutopilotKind::Hamiltonian);
+        }
+        else if (m_autopilotKind == SnakeAutopilotKind::Hamiltonian) {
+            setAutopilot(SnakeAutopilotKind::Mcts);
+        }
+        else {
+            disableAutopilot();
+        }
+    }
+    else if (event->key() == Qt::Key_F3) {
+        setOverlayVisible(!m_overlayVisible);
+    }
+    else if (event->key() == Qt::Key_G) {
+        setGhostRace(!m_ghostRace);
+        return;
+    }
+    else if (event->key() == Qt::Key_L) {
+        // Toggle The Scrolling Large Arena
+        setArenaSize(m_arenaSize > 0 ? 0 : SnakeEngine::MaxGridSize);
+        return;
     }
     else if (event->key() == Qt::Key_Space) {
         if (m_paused) resumeGame();
@@ -508,7 +1052,6 @@ void Snake::keyPressEvent(QKeyEvent *event)
     }
     else if (event->key() == Qt::Key_Escape) {
         m_timer->stop();
-        m_particleTimer->stop();
         hide();
         emit backToHome();
     }
@@ -522,11 +1065,10 @@ void Snake::keyPressEvent(QKeyEvent *event)
  */
 void Snake::resizeEvent(QResizeEvent *event)
 {
-    // Recalculate cell size when widget is resized
-    if (m_gridSize > 0) {
+    // Recalculate cell size when widget is resized (the arena keeps its cell size and scrolls)
+    if (m_gridSize > 0 && m_arenaSize == 0) {
         calculateCellSize();
     }
-    createGradientBackground();
     QWidget::resizeEvent(event);
 }
 
@@ -534,177 +1076,72 @@ void Snake::resizeEvent(QResizeEvent *event)
  * @brief Renders The Game Graphics
  * @param event Paint Event (Unused)
  */
-void Snake::paintEvent(QPaintEvent * /*event*/)
+void Snake::paintEvent(QPaintEvent *event)
 {
-    QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
-    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    QElapsedTimer paintTimer;
+    paintTimer.start();
 
-    // Draw Background
-    painter.fillRect(rect(), m_backgroundGradient);
-
-    // Draw Grid Overlay (more subtle on larger screens)
-    if (m_gridSize > 0 && m_cellSize > 0) {
-        int gridAlpha = qBound(10, 30 - (m_cellSize / 5), 30);
-        painter.setPen(QPen(QColor(255, 255, 255, gridAlpha), 1));
+    // Same Drawing Code As The Offscreen Render Tools
+    QPainter painter(this);
+    m_renderer.render(painter, m_engine, renderState(), event->region());
 
-        int gridWidth = m_gridSize * m_cellSize;
-        for (int x = 0; x <= gridWidth; x += m_cellSize) {
-            painter.drawLine(x, 0, x, gridWidth);
-        }
-        for (int y = 0; y <= gridWidth; y += m_cellSize) {
-            painter.drawLine(0, y, gridWidth, y);
-        }
+    // Performance Overlay Shows The Samples Up To The Previous Frame
+    if (m_overlayVisible) {
+        drawOverlay(painter);
     }
 
-    int blockSize = m_cellSize - 2;
-    int cornerRadius = qBound(4, m_cellSize / 4, 12);
-
-    // Draw Food
-    if (m_food.x() >= 0 && m_food.y() >= 0 && m_gridSize > 0) {
-        QRadialGradient foodGradient(
-            m_food.x() * m_cellSize + m_cellSize/2,
-            m_food.y() * m_cellSize + m_cellSize/2,
-            m_cellSize * 0.8
-            );
-        foodGradient.setColorAt(0, Qt::yellow);
-        foodGradient.setColorAt(0.7, QColor(255, 200, 0));
-        foodGradient.setColorAt(1, QColor(255, 100, 0));
-
-        painter.setBrush(foodGradient);
-        painter.setPen(Qt::NoPen);
-        painter.drawEllipse(
-            m_food.x() * m_cellSize + 2,
-            m_food.y() * m_cellSize + 2,
-            blockSize - 4,
-            blockSize - 4
-            );
-    }
+    // Track Paint Cost (exponential moving average)
+    qint64 elapsed = paintTimer.nsecsElapsed();
+    m_paintTimeNs = m_paintTimeNs == 0 ? elapsed : (m_paintTimeNs * 7 + elapsed) / 8;
 
-    // Draw Particle Effects
-    int particleSize = qBound(2, m_cellSize / 8, 4);
-    painter.setBrush(QColor(255, 255, 255, 100));
-    for (const auto &particle : m_particles) {
-        painter.drawEllipse(particle, particleSize, particleSize);
+    // Record The Frame; gameLoop Time And Ticks Since The Last Paint Belong To It
+    if (m_clock.isValid()) {
+        m_frameSamples.push(SnakeFrameSample{m_clock.nsecsElapsed(), qint32(qMin<qint64>(elapsed, std::numeric_limits<qint32>::max())),
+                                             qint32(qMin<qint64>(m_loopNsSincePaint, std::numeric_limits<qint32>::max())),
+                                             qint16(qMin(m_ticksSincePaint, 32767)), qint16(qMin(m_particles.count(), 32767))});
     }
+    m_loopNsSincePaint = 0;
+    m_ticksSincePaint = 0;
 
-    // Draw Snake Body
-    for (int i = 0; i < m_snake.size(); ++i) {
-        QPoint part = m_snake[i];
-        QRectF rect(
-            part.x() * m_cellSize + 2,
-            part.y() * m_cellSize + 2,
-            blockSize - 4,
-            blockSize - 4
-            );
-
-        if (i == 0) {
-            // Draw Snake Head With Special Effects
-            QRadialGradient headGradient(rect.center(), rect.width());
-            headGradient.setColorAt(0, Qt::red);
-            headGradient.setColorAt(0.7, QColor(200, 0, 0));
-            headGradient.setColorAt(1, QColor(150, 0, 0));
-
-            painter.setBrush(headGradient);
-
-            // Apply Head Scale Animation
-            if (m_headScale != 1.0) {
-                rect = QRectF(
-                    rect.x() - (rect.width() * (m_headScale - 1)) / 2,
-                    rect.y() - (rect.height() * (m_headScale - 1)) / 2,
-                    rect.width() * m_headScale,
-                    rect.height() * m_headScale
-                    );
-            }
-
-            painter.setPen(Qt::NoPen);
-            painter.drawRoundedRect(rect, cornerRadius, cornerRadius);
-
-            // Draw Eyes Based On Direction (scaled with cell size)
-            painter.setBrush(Qt::white);
-            float eyeSize = rect.width() * 0.2;
-            float pupilSize = eyeSize * 0.5;
-
-            if (m_direction.x() > 0) {
-                // Right Direction
-                painter.drawEllipse(rect.right() - eyeSize * 2.5, rect.top() + eyeSize, eyeSize, eyeSize);
-                painter.drawEllipse(rect.right() - eyeSize * 2.5, rect.bottom() - eyeSize * 2, eyeSize, eyeSize);
-
-                painter.setBrush(Qt::black);
-                painter.drawEllipse(rect.right() - eyeSize * 2.5 + pupilSize/2, rect.top() + eyeSize + pupilSize/2, pupilSize, pupilSize);
-                painter.drawEllipse(rect.right() - eyeSize * 2.5 + pupilSize/2, rect.bottom() - eyeSize * 2 + pupilSize/2, pupilSize, pupilSize);
-            }
-            else if (m_direction.x() < 0) {
-                // Left Direction
-                painter.drawEllipse(rect.left() + eyeSize * 1.5, rect.top() + eyeSize, eyeSize, eyeSize);
-                painter.drawEllipse(rect.left() + eyeSize * 1.5, rect.bottom() - eyeSize * 2, eyeSize, eyeSize);
-
-                painter.setBrush(Qt::black);
-                painter.drawEllipse(rect.left() + eyeSize * 1.5 + pupilSize/2, rect.top() + eyeSize + pupilSize/2, pupilSize, pupilSize);
-                painter.drawEllipse(rect.left() + eyeSize * 1.5 + pupilSize/2, rect.bottom() - eyeSize * 2 + pupilSize/2, pupilSize, pupilSize);
-            }
-            else if (m_direction.y() > 0) {
-                // Down Direction
-                painter.drawEllipse(rect.left() + eyeSize, rect.bottom() - eyeSize * 2.5, eyeSize, eyeSize);
-                painter.drawEllipse(rect.right() - eyeSize * 2, rect.bottom() - eyeSize * 2.5, eyeSize, eyeSize);
-
-                painter.setBrush(Qt::black);
-                painter.drawEllipse(rect.left() + eyeSize + pupilSize/2, rect.bottom() - eyeSize * 2.5 + pupilSize/2, pupilSize, pupilSize);
-                painter.drawEllipse(rect.right() - eyeSize * 2 + pupilSize/2, rect.bottom() - eyeSize * 2.5 + pupilSize/2, pupilSize, pupilSize);
-            }
-            else {
-                // Up Direction
-                painter.drawEllipse(rect.left() + eyeSize, rect.top() + eyeSize * 1.5, eyeSize, eyeSize);
-                painter.drawEllipse(rect.right() - eyeSize * 2, rect.top() + eyeSize * 1.5, eyeSize, eyeSize);
-
-                painter.setBrush(Qt::black);
-                painter.drawEllipse(rect.left() + eyeSize + pupilSize/2, rect.top() + eyeSize * 1.5 + pupilSize/2, pupilSize, pupilSize);
-                painter.drawEllipse(rect.right() - eyeSize * 2 + pupilSize/2, rect.top() + eyeSize * 1.5 + pupilSize/2, pupilSize, pupilSize);
-            }
-
-        } else {
-            // Draw Snake Body Segments With Gradient Colors
-            int colorIndex = i % 10;
-            QColor bodyColor = m_snakeColors.contains(colorIndex) ?
-                                   m_snakeColors[colorIndex] :
-                                   QColor(0, 100, 200);
-
-            QLinearGradient bodyGradient(rect.topLeft(), rect.bottomRight());
-            bodyGradient.setColorAt(0, bodyColor.lighter(120));
-            bodyGradient.setColorAt(1, bodyColor.darker(120));
-
-            painter.setBrush(bodyGradient);
-            painter.setPen(QPen(QColor(255, 255, 255, 50), 1));
-            painter.drawRoundedRect(rect, cornerRadius - 2, cornerRadius - 2);
-        }
+    // First Frame Of A Restarted Game
+    if (m_restartRequestedNs >= 0) {
+        m_restartLatencyNs = m_clock.nsecsElapsed() - m_restartRequestedNs;
+        m_restartRequestedNs = -1;
     }
 
-    // Draw Shadow Effect On Food
-    if (m_shadowOffset > 0 && m_food.x() >= 0 && m_food.y() >= 0) {
-        painter.setBrush(QColor(0, 0, 0, 50));
-        painter.setPen(Qt::NoPen);
-        painter.drawEllipse(m_food.x() * m_cellSize + m_cellSize/2 + m_shadowOffset,
-                            m_food.y() * m_cellSize + m_cellSize/2 + m_shadowOffset,
-                            m_cellSize/3, m_cellSize/3);
+    // Turns Applied Since The Last Paint Are On Screen Once This Frame Is Flushed
+    if (!m_shownInputs.isEmpty()) {
+        qint64 paintedNs = m_clock.nsecsElapsed();
+        for (qint64 pressedNs : m_shownInputs) {
+            m_inputLatency.record(paintedNs - pressedNs);
+        }
+        m_shownInputs.clear();
     }
+}
 
-    // Draw Current Score (scaled with widget)
-    painter.setPen(Qt::white);
-    int scoreFontSize = qBound(16, width() / 15, 32);
-    QFont scoreFont = QFont("Arial", scoreFontSize, QFont::Bold);
-    scoreFont.setLetterSpacing(QFont::AbsoluteSpacing, 2);
-    painter.setFont(scoreFont);
-
-    QRect scoreRect(0, height() - scoreFontSize * 2, width(), scoreFontSize * 1.5);
-    painter.drawText(scoreRect, Qt::AlignCenter, QString("%1").arg(m_score));
-
-    // Draw Pause Indicator
-    if (m_paused) {
-        painter.setPen(QPen(QColor(255, 255, 255, 200), 3));
-        int pauseFontSize = qBound(24, width() / 10, 48);
-        painter.setFont(QFont("Arial", pauseFontSize, QFont::Bold));
-        painter.drawText(rect(), Qt::AlignCenter, "PAUSED");
+/**
+ * @brief Presentation State Handed To The Renderer
+ */
+SnakeRenderState Snake::renderState() const
+{
+    SnakeRenderState state;
+    state.size = size();
+    state.devicePixelRatio = devicePixelRatioF();
+    state.cellSize = m_cellSize;
+    state.difficulty = m_currentDifficulty;
+    state.arena = m_arenaSize > 0;
+    state.camera = m_camera;
+    state.tickProgress = m_interpolate ? m_tickProgress : 1.0;
+    state.headScale = m_headScale;
+    state.shadowOffset = m_shadowOffset;
+    state.particles = &m_particles;
+    state.score = m_score;
+    state.paused = m_paused;
+    if (isGhostVisible()) {
+        state.ghost = &m_ghostEngine;
+        state.ghostProgress = m_ghostEngine.tickCount() > 0 ? m_tickProgress : 1.0;
     }
+    return state;
 }
 
 /**
@@ -718,155 +1155,21 @@ void Snake::updateScore(int newScore)
     }
 }
 
+/**
+ * @brief Shows The Reusable Result Panel Over The Board
+ */
+void Snake::showResult(SnakeResultOverlay::Kind kind)
+{
+    m_resultOverlay->showResult(kind, m_score);
+    m_activity->start(m_resultOverlay->fadeAnimation());
+}
+
 /**
  * @brief Displays The Win Dialog
  */
 void Snake::showWinDialog()
 {
-    // Calculate overlay size based on widget size
-    int overlayWidth = qMin(400, width() - 100);
-    int overlayHeight = qMin(480, height() - 100);
-
-    // Create Overlay Widget
-    QWidget *overlay = new QWidget(this);
-    overlay->setFixedSize(overlayWidth, overlayHeight);
-    overlay->move((width() - overlayWidth) / 2, (height() - overlayHeight) / 2);
-
-    overlay->setStyleSheet(
-        "background-color: #1a1e2b;"
-        "border-radius: 40px;"
-        "border: 1px solid #2a2f3c;"
-        );
-
-    // Add Shadow Effect
-    QGraphicsDropShadowEffect *shadowEffect = new QGraphicsDropShadowEffect();
-    shadowEffect->setBlurRadius(40);
-    shadowEffect->setColor(QColor(0, 0, 0, 150));
-    shadowEffect->setOffset(0, 8);
-    overlay->setGraphicsEffect(shadowEffect);
-
-    // Setup Main Layout
-    QVBoxLayout *layout = new QVBoxLayout(overlay);
-    layout->setSpacing(15);
-    layout->setContentsMargins(40, 35, 40, 35);
-
-    // Create Win Title
-    QLabel *winLabel = new QLabel("🎉 YOU WIN! 🎉");
-    winLabel->setFixedHeight(overlayHeight / 8);
-    winLabel->setAlignment(Qt::AlignCenter);
-
-    int titleFontSize = qBound(20, overlayWidth / 12, 28);
-    winLabel->setStyleSheet(
-        QString("QLabel {"
-                "   background-color: #2a2f3c;"
-                "   color: #2ecc71;"
-                "   border-radius: %1px;"
-                "   font-size: %2px;"
-                "   font-weight: 900;"
-                "   font-family: 'Arial Black';"
-                "   letter-spacing: 2px;"
-                "}").arg(overlayHeight / 16).arg(titleFontSize)
-        );
-    layout->addWidget(winLabel);
-
-    // Add Decorative Line
-    QFrame *line = new QFrame();
-    line->setFixedHeight(4);
-    line->setFixedWidth(overlayWidth / 2);
-    line->setStyleSheet(
-        "background: qlineargradient(x1:0, y1:0, x2:1, y2:0, stop:0 transparent, stop:0.5 #2ecc71, stop:1 transparent);"
-        "border-radius: 2px;"
-        );
-    layout->addWidget(line, 0, Qt::AlignCenter);
-
-    layout->addSpacing(5);
-
-    // Create Score Display Card
-    QWidget *scoreCard = new QWidget();
-    scoreCard->setFixedHeight(overlayHeight / 4);
-    scoreCard->setStyleSheet(
-        "QWidget {"
-        "   background-color: qlineargradient(x1:0, y1:0, x2:0, y2:1, stop:0 #232837, stop:1 #1c212d);"
-        "   border-radius: 55px;"
-        "   border: 1px solid #2a2f3c;"
-        "}"
-        );
-
-    QVBoxLayout *scoreLayout = new QVBoxLayout(scoreCard);
-    scoreLayout->setContentsMargins(0, 15, 0, 15);
-    scoreLayout->setSpacing(0);
-
-    QLabel *scoreTitle = new QLabel("YOUR SCORE");
-    scoreTitle->setAlignment(Qt::AlignCenter);
-    scoreTitle->setStyleSheet("color: #8f9bb5; font-size: 13px; font-weight: 700; border: none; background: transparent;");
-
-    QLabel *scoreValue = new QLabel(QString("%1").arg(m_score));
-    scoreValue->setAlignment(Qt::AlignCenter);
-
-    int scoreFontSize = qBound(32, overlayWidth / 8, 46);
-    scoreValue->setStyleSheet(QString("color: #ffffff; font-size: %1px; font-weight: 800; border: none; background: transparent;").arg(scoreFontSize));
-
-    scoreLayout->addWidget(scoreTitle);
-    scoreLayout->addWidget(scoreValue);
-    layout->addWidget(scoreCard);
-
-    layout->addSpacing(15);
-
-    // Create Action Buttons
-    QPushButton *restartBtn = new QPushButton("PLAY AGAIN");
-    restartBtn->setCursor(Qt::PointingHandCursor);
-    restartBtn->setFixedHeight(overlayHeight / 8);
-    restartBtn->setStyleSheet(
-        "QPushButton {"
-        "   background-color: qlineargradient(x1:0, y1:0, x2:1, y2:0, stop:0 #2ecc71, stop:1 #27ae60);"
-        "   color: white;"
-        "   border-radius: 28px;"
-        "   font-size: 16px;"
-        "   font-weight: 700;"
-        "   border: none;"
-        "}"
-        "QPushButton:hover { background-color: #27ae60; }"
-        );
-
-    QPushButton *homeBtn = new QPushButton("HOME");
-    homeBtn->setCursor(Qt::PointingHandCursor);
-    homeBtn->setFixedHeight(overlayHeight / 8);
-    homeBtn->setStyleSheet(
-        "QPushButton {"
-        "   background-color: #2f3545;"
-        "   color: #e5e7eb;"
-        "   border-radius: 28px;"
-        "   font-size: 16px;"
-        "   font-weight: 700;"
-        "   border: none;"
-        "}"
-        "QPushButton:hover { background-color: #3f4559; }"
-        );
-
-    layout->addWidget(restartBtn);
-    layout->addWidget(homeBtn);
-
-    // Display Overlay With Fade Animation
-    overlay->show();
-    overlay->raise();
-
-    QPropertyAnimation *fadeAnim = new QPropertyAnimation(overlay, "windowOpacity");
-    fadeAnim->setDuration(350);
-    fadeAnim->setStartValue(0);
-    fadeAnim->setEndValue(1);
-    fadeAnim->start(QAbstractAnimation::DeleteWhenStopped);
-
-    // Connect Button Signals
-    connect(restartBtn, &QPushButton::clicked, [this, overlay](){
-        overlay->deleteLater();
-        initGame(m_currentDifficulty);
-    });
-
-    connect(homeBtn, &QPushButton::clicked, [this, overlay](){
-        overlay->deleteLater();
-        this->hide();
-        emit backToHome();
-    });
+    showResult(SnakeResultOverlay::Win);
 }
 
 /**
@@ -874,150 +1177,7 @@ void Snake::showWinDialog()
  */
 void Snake::showGameOverDialog()
 {
-    // Calculate overlay size based on widget size
-    int overlayWidth = qMin(400, width() - 100);
-    int overlayHeight = qMin(480, height() - 100);
-
-    // Create Overlay Widget
-    QWidget *overlay = new QWidget(this);
-    overlay->setFixedSize(overlayWidth, overlayHeight);
-    overlay->move((width() - overlayWidth) / 2, (height() - overlayHeight) / 2);
-
-    overlay->setStyleSheet(
-        "background-color: #1a1e2b;"
-        "border-radius: 40px;"
-        "border: 1px solid #2a2f3c;"
-        );
-
-    // Add Shadow Effect
-    QGraphicsDropShadowEffect *shadowEffect = new QGraphicsDropShadowEffect();
-    shadowEffect->setBlurRadius(40);
-    shadowEffect->setColor(QColor(0, 0, 0, 150));
-    shadowEffect->setOffset(0, 8);
-    overlay->setGraphicsEffect(shadowEffect);
-
-    // Setup Main Layout
-    QVBoxLayout *layout = new QVBoxLayout(overlay);
-    layout->setSpacing(15);
-    layout->setContentsMargins(40, 35, 40, 35);
-
-    // Create Game Over Title
-    QLabel *gameOverLabel = new QLabel("GAME OVER");
-    gameOverLabel->setFixedHeight(overlayHeight / 8);
-    gameOverLabel->setAlignment(Qt::AlignCenter);
-
-    int titleFontSize = qBound(20, overlayWidth / 12, 28);
-    gameOverLabel->setStyleSheet(
-        QString("QLabel {"
-                "   background-color: #2a2f3c;"
-                "   color: #ff5e5e;"
-                "   border-radius: %1px;"
-                "   font-size: %2px;"
-                "   font-weight: 900;"
-                "   font-family: 'Arial Black';"
-                "   letter-spacing: 2px;"
-                "}").arg(overlayHeight / 16).arg(titleFontSize)
-        );
-    layout->addWidget(gameOverLabel);
-
-    // Add Decorative Line
-    QFrame *line = new QFrame();
-    line->setFixedHeight(4);
-    line->setFixedWidth(overlayWidth / 2);
-    line->setStyleSheet(
-        "background: qlineargradient(x1:0, y1:0, x2:1, y2:0, stop:0 transparent, stop:0.5 #e74c3c, stop:1 transparent);"
-        "border-radius: 2px;"
-        );
-    layout->addWidget(line, 0, Qt::AlignCenter);
-
-    layout->addSpacing(5);
-
-    // Create Score Display Card
-    QWidget *scoreCard = new QWidget();
-    scoreCard->setFixedHeight(overlayHeight / 4);
-    scoreCard->setStyleSheet(
-        "QWidget {"
-        "   background-color: qlineargradient(x1:0, y1:0, x2:0, y2:1, stop:0 #232837, stop:1 #1c212d);"
-        "   border-radius: 55px;"
-        "   border: 1px solid #2a2f3c;"
-        "}"
-        );
-
-    QVBoxLayout *scoreLayout = new QVBoxLayout(scoreCard);
-    scoreLayout->setContentsMargins(0, 15, 0, 15);
-    scoreLayout->setSpacing(0);
-
-    QLabel *scoreTitle = new QLabel("YOUR SCORE");
-    scoreTitle->setAlignment(Qt::AlignCenter);
-    scoreTitle->setStyleSheet("color: #8f9bb5; font-size: 13px; font-weight: 700; border: none; background: transparent;");
-
-    QLabel *scoreValue = new QLabel(QString("%1").arg(m_score));
-    scoreValue->setAlignment(Qt::AlignCenter);
-
-    int scoreFontSize = qBound(32, overlayWidth / 8, 46);
-    scoreValue->setStyleSheet(QString("color: #ffffff; font-size: %1px; font-weight: 800; border: none; background: transparent;").arg(scoreFontSize));
-
-    scoreLayout->addWidget(scoreTitle);
-    scoreLayout->addWidget(scoreValue);
-    layout->addWidget(scoreCard);
-
-    layout->addSpacing(15);
-
-    // Create Action Buttons
-    QPushButton *restartBtn = new QPushButton("PLAY AGAIN");
-    restartBtn->setCursor(Qt::PointingHandCursor);
-    restartBtn->setFixedHeight(overlayHeight / 8);
-    restartBtn->setStyleSheet(
-        "QPushButton {"
-        "   background-color: qlineargradient(x1:0, y1:0, x2:1, y2:0, stop:0 #e74c3c, stop:1 #c0392b);"
-        "   color: white;"
-        "   border-radius: 28px;"
-        "   font-size: 16px;"
-        "   font-weight: 700;"
-        "   border: none;"
-        "}"
-        "QPushButton:hover { background-color: #c0392b; }"
-        );
-
-    QPushButton *homeBtn = new QPushButton("HOME");
-    homeBtn->setCursor(Qt::PointingHandCursor);
-    homeBtn->setFixedHeight(overlayHeight / 8);
-    homeBtn->setStyleSheet(
-        "QPushButton {"
-        "   background-color: #2f3545;"
-        "   color: #e5e7eb;"
-        "   border-radius: 28px;"
-        "   font-size: 16px;"
-        "   font-weight: 700;"
-        "   border: none;"
-        "}"
-        "QPushButton:hover { background-color: #3f4559; }"
-        );
-
-    layout->addWidget(restartBtn);
-    layout->addWidget(homeBtn);
-
-    // Display Overlay With Fade Animation
-    overlay->show();
-    overlay->raise();
-
-    QPropertyAnimation *fadeAnim = new QPropertyAnimation(overlay, "windowOpacity");
-    fadeAnim->setDuration(350);
-    fadeAnim->setStartValue(0);
-    fadeAnim->setEndValue(1);
-    fadeAnim->start(QAbstractAnimation::DeleteWhenStopped);
-
-    // Connect Button Signals
-    connect(restartBtn, &QPushButton::clicked, [this, overlay](){
-        overlay->deleteLater();
-        initGame(m_currentDifficulty);
-    });
-
-    connect(homeBtn, &QPushButton::clicked, [this, overlay](){
-        overlay->deleteLater();
-        this->hide();
-        emit backToHome();
-    });
+    showResult(SnakeResultOverlay::GameOver);
 }
 
 /**
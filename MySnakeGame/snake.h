@@ -15,7 +15,32 @@
 #include <QPainter>
 #include <QResizeEvent>
 #include <QShowEvent>  // Add this for showEvent
+#include <QHideEvent>
+#include <QElapsedTimer>
+#include <QPixmap>
+#include <memory>
 #include "gamesizes.h"  // Add this for universal sizing
+#include "snakeactivity.h"
+#include "snakeautopilot.h"
+#include "snakeengine.h"
+#include "snakeinputqueue.h"
+#include "snakemap.h"
+#include "snakeparticles.h"
+#include "snakerenderer.h"
+#include "snakereplay.h"
+#include "snakeresultoverlay.h"
+#include "snakesamplering.h"
+#include "snaketickscheduler.h"
+
+// Timing Of One Painted Frame, Kept In The Instrumentation Ring
+struct SnakeFrameSample
+{
+    qint64 timestampNs;             // End Of paintEvent On The Widget's Monotonic Clock
+    qint32 paintNs;                 // paintEvent Duration
+    qint32 loopNs;                  // gameLoop Time Spent Since The Previous Paint
+    qint16 ticks;                   // Ticks Run Since The Previous Paint
+    qint16 particles;               // Live Particles When Painted
+};
 
 // Snake Game Widget Class Responsible For Core Gameplay Logic And Rendering
 class Snake : public QWidget
@@ -52,11 +77,11 @@ public:
 
     // Getter And Setter For Head Scale Property
     float headScale() const { return m_headScale; }
-    void setHeadScale(float scale) { m_headScale = scale; update(); }
+    void setHeadScale(float scale) { m_headScale = scale; update(headArea()); }
 
     // Getter And Setter For Shadow Offset Property
     int shadowOffset() const { return m_shadowOffset; }
-    void setShadowOffset(int offset) { m_shadowOffset = offset; update(); }
+    void setShadowOffset(int offset) { m_shadowOffset = offset; update(foodArea()); }
 
     // Getter And Setter For Pause State Property
     bool isPaused() const { return m_paused; }
@@ -71,6 +96,70 @@ public:
     // Get grid size (number of cells)
     int gridSize() const { return m_gridSize; }
 
+    // Configure Simulation Tick Interval And Display Frame Rate Independently
+    void setTickInterval(int milliseconds);
+    int tickInterval() const { return m_tickIntervalMs; }
+    void setFrameRate(int framesPerSecond);
+    int frameRate() const { return m_frameRate; }
+
+    // Ticks Caught Up Late Or Dropped By The Render Loop Since The Game Started
+    int lateTicks() const { return int(m_scheduler.lateTicks()); }
+    int droppedTicks() const { return int(m_scheduler.droppedTicks()); }
+
+    // Tick Lateness And Interval Histograms Plus The Achieved Tick Rate
+    const SnakeTickScheduler &tickScheduler() const { return m_scheduler; }
+    double achievedTickRate() const { return m_scheduler.tickRate(m_clock.isValid() ? m_clock.nsecsElapsed() : 0); }
+
+    // Key Press To Tick Applying It, And Key Press To The First Frame Painted After That Tick
+    const SnakeHistogram &inputQueueDelay() const { return m_inputQueueDelay; }
+    const SnakeHistogram &inputLatency() const { return m_inputLatency; }
+
+    // Smoothed paintEvent Duration In Nanoseconds
+    qint64 paintTimeNs() const { return m_paintTimeNs; }
+
+    // Performance Overlay (F3): Frame Times, FPS, Tick Lateness Histogram And Particle Count
+    void setOverlayVisible(bool visible);
+    bool isOverlayVisible() const { return m_overlayVisible; }
+
+    // Per-Frame Samples Behind The Overlay; Safe To Read From Any Thread
+    const SnakeSampleRing<SnakeFrameSample> &frameSamples() const { return m_frameSamples; }
+
+    // Write The Buffered Samples As CSV, Returns false When The File Cannot Be Written
+    bool exportFrameStats(const QString &path) const;
+
+    // Export Automatically When The Widget Is Destroyed (Empty Path Disables)
+    void setFrameStatsExportPath(const QString &path) { m_frameStatsPath = path; }
+
+    // Hand Steering To An Autopilot Strategy, Or Back To The Keyboard. Ignored In Arena Mode
+    void setAutopilot(SnakeAutopilotKind kind);
+    void disableAutopilot();
+    bool isAutopilotEnabled() const { return m_autopilot != nullptr; }
+
+    // Large Arena Mode: Grid Of gridSize Cells (Up To SnakeEngine::MaxGridSize) Seen Through
+    // A Camera That Follows The Head; 0 Returns To The Difficulty Sized Board. Restarts The Game
+    void setArenaSize(int gridSize);
+    int arenaSize() const { return m_arenaSize; }
+
+    // Play A Level Map With Walls (nullptr Returns To The Open Board). Maps Larger Than The Biggest
+    // Board Scroll Like The Arena, Without Autopilot. Attach Fields First For Faster Autopilots. Restarts The Game
+    void setMap(std::shared_ptr<const SnakeMap> map);
+    const SnakeMap *map() const { return m_map.get(); }
+
+    // Timers And Animations Stopped While Paused, Hidden Or Inactive, With Their Wake-Up Counts
+    const SnakeActivityRegistry *activity() const { return m_activity; }
+
+    // Game End To Result Panel Painted, And Restart To The New Game's First Painted Frame
+    qint64 resultLatencyNs() const { return m_resultLatencyNs; }
+    qint64 restartLatencyNs() const { return m_restartLatencyNs; }
+
+    // Seed And Inputs Of The Current Or Most Recent Game
+    const SnakeReplay &replay() const { return m_recorder.replay(); }
+
+    // Ghost Race (G): The Best Recorded Run For This Difficulty, Grid And Map Is Replayed As A
+    // Translucent Snake In Lockstep, Starting From The Same Seed. Restarts The Game
+    void setGhostRace(bool enabled);
+    bool isGhostRace() const { return m_ghostRace; }
+
 signals:
     // Signal Emitted When Game Starts
     void gameStarted();
@@ -87,6 +176,9 @@ signals:
     // Signal Emitted To Navigate Back To Home Screen
     void backToHome();
 
+    // Signal Emitted When A Frame Had To Catch Up Or Skip Simulation Ticks
+    void tickTimingIssue(int lateTicks, int droppedTicks);
+
 protected:
     // Handle Keyboard Input For Snake Movement And Controls
     void keyPressEvent(QKeyEvent *event) override;
@@ -97,25 +189,84 @@ protected:
     // Adjust Layout And Grid When Window Is Resized
     void resizeEvent(QResizeEvent *event) override;
 
-    // Handle widget show event - start game when shown
+    // Resume Timers And Animations When Shown; The Game Itself Is Started By initGame()
     void showEvent(QShowEvent *event) override;
 
+    // Suspend Timers And Animations While Hidden
+    void hideEvent(QHideEvent *event) override;
+
+    // Suspend Timers And Animations While The Window Is Inactive
+    void changeEvent(QEvent *event) override;
+
 private slots:
-    // Main Game Loop Executed On Timer Timeout
+    // Render Loop Executed Every Frame, Runs Any Simulation Ticks That Fell Due
     void gameLoop();
 
     // Animate Snake Head For Visual Enhancement
     void animateHead();
 
+    // Freeze The Tick Schedule When The Activity Registry Stops Everything
+    void suspendActivity();
+
+    // Re-Anchor The Clock And Restart The Render Loop When The Registry Resumes
+    void resumeActivity();
+
 private:
-    // Move Snake According To Current Direction
+    // Advance The Engine One Tick And React To The Outcome
     void moveSnake();
 
-    // Check For Wall Or Self Collision
-    bool checkCollision();
+    // Emit Particle Burst Around The Current Food
+    void spawnFoodParticles();
+
+    // Re-Anchor The Frame Clock So Time Spent Stopped Does Not Count As Ticks
+    void restartClock();
+
+    // Start The Render Loop Immediately, Then Let Each Frame Arm The Next Wake-Up
+    void startRenderLoop();
+
+    // Arm The Timer For The Next Frame Deadline Or Tick Deadline, Whichever Comes First
+    void scheduleNextFrame(qint64 now);
+
+    // Widget Rectangle Covered By A Grid Cell
+    QRect cellRect(SnakeCell cell) const;
+
+    // Arena Camera: Ease The Viewport Toward The Head, Or Jump There When snap Is Set
+    void updateCamera(qreal frameSeconds, bool snap = false);
+
+    // Areas Repainted Incrementally: Tweened Head, Tweened Tail, Food With Shadow, Particles, Score
+    QRect headArea() const;
+    QRect tailArea() const;
+    QRect foodArea() const;
+    QRect particleArea() const;
+    QRect scoreArea() const;
 
-    // Spawn Food At Random Valid Position
-    void spawnFood();
+    // Tweened Head And Tail Of The Ghost, Empty While It Is Hidden
+    QRegion ghostArea() const;
+
+    // Ghost Replay Loaded And Not Yet Over
+    bool isGhostVisible() const { return m_ghostPlayer && !m_ghostPlayer->finished(m_ghostEngine); }
+
+    // Panel Drawn By The Performance Overlay
+    QRect overlayArea() const;
+
+    // Union Of Every Area The Dynamic Layer Draws Into This Frame
+    QRegion dynamicRegion() const;
+
+    // Draw The Performance Overlay From The Latest Frame Samples
+    void drawOverlay(QPainter &painter);
+
+    // Close The Recording And Write It To The Replay File, Keeping It As The Best Run If It Scored More
+    void saveReplay();
+
+    // "best_snake_replay_<difficulty>_<grid>_<map hash>.snkr" For The Current Game
+    QString bestReplayPath() const;
+
+    // Replay File Helpers
+    static bool readReplayFile(const QString &path, SnakeReplay &replay);
+    static bool writeReplayFile(const QString &path, const SnakeReplay &replay);
+
+    // Fade In The Shared Result Panel, Built On The First Game End
+    void showResult(SnakeResultOverlay::Kind kind);
 
     // Display Win Dialog When Player Fills The Grid
     void showWinDialog();
@@ -126,8 +277,8 @@ private:
     // Update Score And Trigger UI Changes
     void updateScore(int newScore);
 
-    // Create Gradient Background For Game Area
-    void createGradientBackground();
+    // Camera, Tweens And Animations For SnakeRenderer
+    SnakeRenderState renderState() const;
 
     // Calculate cell size based on widget size
     void calculateCellSize();
@@ -139,29 +290,65 @@ private:
     QSize calculateOptimalSize() const;
 
     // Game State Variables
-    QVector<QPoint> m_snake;        // Stores Snake Body Segments
-    QPoint m_food;                  // Current Food Position
-    QPoint m_direction;             // Current Movement Direction
-    QPoint m_nextDirection;         // Buffered Next Direction
-    QTimer *m_timer;                // Main Game Loop Timer
+    SnakeEngine m_engine;           // Headless Game Rules And Snake State
+    SnakeDirection m_nextDirection; // Direction Steered On The Latest Tick
+    SnakeInputQueue m_inputQueue;   // Turns Pressed But Not Yet Applied, One Per Tick
+    QVector<qint64> m_shownInputs;  // Key Timestamps Of Turns Applied Since The Last Paint
+    SnakeHistogram m_inputQueueDelay;      // Key To Tick, 0.5 ms Buckets
+    SnakeHistogram m_inputLatency;         // Key To Painted Frame, 0.5 ms Buckets
+    std::unique_ptr<SnakeStrategy> m_autopilot;  // Active Autopilot, Null While The Player Steers
+    SnakeAutopilotKind m_autopilotKind;          // Strategy Last Selected With The A Key
+    SnakeReplayRecorder m_recorder;              // Records Every Game For Exact Playback
+    bool m_ghostRace;                            // Race The Best Recorded Run
+    SnakeReplay m_ghostReplay;                   // That Run's Compact Input Log
+    std::unique_ptr<SnakeReplayPlayer> m_ghostPlayer;  // Decodes m_ghostReplay One Input At A Time
+    SnakeEngine m_ghostEngine;                   // Ghost Snake, Stepped Once Per Live Tick
+    QTimer *m_timer;                // Precise Single Shot Timer, Re-Armed For Each Frame Or Tick
     bool m_gameOver;                // Game Over Flag
     bool m_paused;                  // Pause State Flag
     int m_score;                    // Current Player Score
     int m_gridSize;                 // Grid Dimension Count (e.g., 15, 20, 25 based on difficulty)
     int m_cellSize;                 // Pixel Size Of Each Grid Cell (calculated dynamically)
     int m_currentDifficulty;        // Selected Difficulty Level
+    int m_arenaSize;                // Large Arena Grid Size, 0 For The Normal Board
+    std::shared_ptr<const SnakeMap> m_map;  // Level Being Played, Null For The Open Board
+    quint64 m_mapHash;              // m_map->hash(), Stored In Replays
+    QPointF m_camera;               // World Pixel Shown At The Widget's Top Left Corner
+    SnakeResultOverlay *m_resultOverlay;   // Game Over / Win Panel, Created Once And Reused
+    qint64 m_resultRequestedNs;     // Clock Reading When The Game Ended, -1 Once The Panel Is Painted
+    qint64 m_resultLatencyNs;       // Last Game End To Panel Painted
+    qint64 m_restartRequestedNs;    // Clock Reading At initGame(), -1 Once A Frame Is Painted
+    qint64 m_restartLatencyNs;      // Last initGame() To First Painted Frame
+
+    // Fixed Timestep Clock Variables
+    QElapsedTimer m_clock;          // Monotonic Clock Driving The Simulation
+    qint64 m_lastFrameNs;           // Clock Reading At The Previous Frame
+    qint64 m_nextFrameNs;           // Deadline Of The Next Frame, Advanced By Exact Frame Periods
+    SnakeTickScheduler m_scheduler; // Drift Free Tick Deadlines And Jitter Statistics
+    int m_tickIntervalMs;           // Fixed Simulation Timestep
+    int m_frameRate;                // Target Render Frames Per Second
+    qreal m_tickProgress;           // Fraction Of The Next Tick Already Elapsed
+    bool m_interpolate;             // Last Tick Moved The Snake, Segments Can Be Tweened
+    QRegion m_lastDynamicRegion;    // Dynamic Areas Drawn Last Frame, Erased On The Next
 
     // Visual Enhancement Variables
     float m_headScale;              // Head Animation Scaling Factor
     int m_shadowOffset;             // Shadow Offset For Visual Depth
     QPropertyAnimation *m_headAnimation;   // Animation For Head Scaling
     QPropertyAnimation *m_shadowAnimation; // Animation For Shadow Effect
-    QLinearGradient m_backgroundGradient;  // Gradient Background
-    QMap<int, QColor> m_snakeColors;       // Color Map For Snake Body
+    SnakeActivityRegistry *m_activity;     // Stops m_timer And Both Animations While Idle
+    qint64 m_paintTimeNs;                  // Smoothed Paint Duration
+
+    // Instrumentation Variables
+    SnakeSampleRing<SnakeFrameSample> m_frameSamples;  // Last 16K Painted Frames
+    qint64 m_loopNsSincePaint;             // gameLoop Time Not Yet Attributed To A Frame
+    int m_ticksSincePaint;                 // Ticks Not Yet Attributed To A Frame
+    bool m_overlayVisible;                 // Draw The Performance Overlay
+    QString m_frameStatsPath;              // CSV Written On Destruction When Set
+    SnakeRenderer m_renderer;              // Background Layer, Sprites And Frame Drawing
 
     // Particle Effect Variables
-    QVector<QPointF> m_particles;   // Decorative Particle Positions
-    QTimer *m_particleTimer;        // Timer For Particle Animation
+    ParticlePool m_particles;       // Decorative Particles, Stepped By The Frame Clock
 };
 
 #endif // SNAKE_H
@@ -0,0 +1,96 @@
+#include "snakeactivity.h"
+#include <QVariantAnimation>
+
+/**
+ * @brief Constructor For A Registry Of A Screen That Is Not Shown Yet
+ * @param parent Owning Screen
+ */
+SnakeActivityRegistry::SnakeActivityRegistry(QObject *parent)
+    : QObject(parent)
+    , m_reasons(Hidden)
+    , m_wakeups(0)
+    , m_idleWakeups(0)
+{
+}
+
+/**
+ * @brief Registers A Timer, Counting Its Timeouts As Wake-Ups
+ */
+void SnakeActivityRegistry::addTimer(QTimer *timer)
+{
+    m_timers.append(timer);
+    connect(timer, &QTimer::timeout, this, &SnakeActivityRegistry::noteWakeup);
+    if (isSuspended()) timer->stop();
+}
+
+/**
+ * @brief Registers An Animation, Counting Each Animated Step As A Wake-Up
+ */
+void SnakeActivityRegistry::addAnimation(QAbstractAnimation *animation)
+{
+    m_animations.append(animation);
+    if (auto *variant = qobject_cast<QVariantAnimation *>(animation)) {
+        connect(variant, &QVariantAnimation::valueChanged, this, &SnakeActivityRegistry::noteWakeup);
+    }
+    if (isSuspended() && animation->state() == QAbstractAnimation::Running) animation->pause();
+}
+
+/**
+ * @brief Starts An Animation, Paused Until The Screen Is Active
+ */
+void SnakeActivityRegistry::start(QAbstractAnimation *animation)
+{
+    animation->start();
+    if (isSuspended()) animation->pause();
+}
+
+/**
+ * @brief Adds A Reason To Be Idle; The First One Stops Every Registered Source
+ */
+void SnakeActivityRegistry::suspend(Reason reason)
+{
+    bool wasSuspended = isSuspended();
+    m_reasons |= reason;
+    if (wasSuspended) return;
+
+    for (QTimer *timer : m_timers) {
+        timer->stop();
+    }
+    for (QAbstractAnimation *animation : m_animations) {
+        if (animation->state() == QAbstractAnimation::Running) animation->pause();
+    }
+    emit suspended();
+}
+
+/**
+ * @brief Clears A Reason To Be Idle; Clearing The Last One Continues The Animations
+ */
+void SnakeActivityRegistry::resume(Reason reason)
+{
+    if (!isSuspended(reason)) return;
+    m_reasons &= ~reason;
+    if (isSuspended()) return;
+
+    for (QAbstractAnimation *animation : m_animations) {
+        if (animation->state() == QAbstractAnimation::Paused) animation->resume();
+    }
+    emit resumed();
+}
+
+/**
+ * @brief suspend() Or resume() Depending On suspended
+ */
+void SnakeActivityRegistry::setSuspended(Reason reason, bool suspended)
+{
+    if (suspended) suspend(reason);
+    else resume(reason);
+}
+
+/**
+ * @brief Counts A Wake-Up, Separately When It Arrived While Suspended
+ */
+void SnakeActivityRegistry::noteWakeup()
+{
+    ++m_wakeups;
+    if (isSuspended()) ++m_idleWakeups;
+}
@@ -0,0 +1,71 @@
+#ifndef SNAKEACTIVITY_H
+#define SNAKEACTIVITY_H
+
+#include <QAbstractAnimation>
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+
+// Every Timer And Animation That Can Wake A Screen, Stopped And Resumed Together
+//
+// A screen registers its repaint sources once and reports why it should be
+// idle: paused by the player, hidden, or its window lost activation. While
+// any reason holds, registered timers are stopped and running animations are
+// paused at their current time, so a suspended screen schedules no wake-ups
+// at all. When the last reason clears, the animations continue exactly where
+// they stopped and resumed() lets the owner re-arm its timers against fresh
+// deadlines. Timer timeouts and animation steps are counted, and those that
+// still arrive while suspended are counted separately as idle wake-ups.
+class SnakeActivityRegistry : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Reasons To Be Idle, Combined As Bit Flags
+    enum Reason {
+        Paused = 0x1,       // Player Paused The Game
+        Hidden = 0x2,       // Screen Is Not Visible
+        Inactive = 0x4      // Window Does Not Have Activation
+    };
+
+    // Starts Suspended As Hidden, Like A Widget That Has Not Been Shown Yet
+    explicit SnakeActivityRegistry(QObject *parent = nullptr);
+
+    // Register Repaint Sources; They Must Outlive The Registry Or Share Its Parent
+    void addTimer(QTimer *timer);
+    void addAnimation(QAbstractAnimation *animation);
+
+    // Start An Animation (No-Op While It Runs), Leaving It Paused At Time 0 While Suspended
+    void start(QAbstractAnimation *animation);
+
+    // Add Or Clear A Reason; Crossing To Or From No Reasons Emits The Matching Signal
+    void suspend(Reason reason);
+    void resume(Reason reason);
+    void setSuspended(Reason reason, bool suspended);
+
+    bool isSuspended() const { return m_reasons != 0; }
+    bool isSuspended(Reason reason) const { return (m_reasons & reason) != 0; }
+
+    // Timer Timeouts And Animation Steps Since Construction, And Those Seen While Suspended
+    quint64 wakeups() const { return m_wakeups; }
+    quint64 idleWakeups() const { return m_idleWakeups; }
+
+signals:
+    // Everything Registered Was Stopped; Freeze Clocks Here
+    void suspended();
+
+    // Animations Continue; Restart Clocks And Re-Arm Timers Here
+    void resumed();
+
+private:
+    // Count One Wake-Up From A Registered Source
+    void noteWakeup();
+
+    QVector<QTimer *> m_timers;
+    QVector<QAbstractAnimation *> m_animations;
+    int m_reasons;
+    quint64 m_wakeups;
+    quint64 m_idleWakeups;
+};
+
+#endif // SNAKEACTIVITY_H
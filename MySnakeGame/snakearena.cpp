@@ -0,0 +1,442 @@
+#include "snakearena.h"
+#include "snakeengine.h"
+#include "snakethreadpool.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+/**
+ * @brief Constructor
+ * @param gridSize Grid Dimension Count
+ * @param snakeCount Snakes Sharing The Grid, All AI Controlled Until setPlayerControlled()
+ * @param foodCount Food Items Kept On The Grid
+ * @param seed Seed For Spawns, Food And Every Snake's Tie Breaks
+ */
+SnakeArena::SnakeArena(int gridSize, int snakeCount, int foodCount, std::uint64_t seed)
+    : m_gridSize(std::clamp(gridSize, 8, SnakeEngine::MaxGridSize))
+    , m_cells(m_gridSize * m_gridSize)
+    , m_tilesPerSide((m_gridSize + FoodTileSize - 1) / FoodTileSize)
+    , m_respawnTicks(0)
+    , m_aliveCount(0)
+    , m_lastDeaths(0)
+    , m_lastHeadOnDeaths(0)
+    , m_tickCount(0)
+    , m_rng(seed)
+    , m_snakes(std::clamp(snakeCount, 0, MaxSnakes))
+    , m_food(std::max(0, foodCount), -1)
+    , m_foodTileSlot(m_food.size(), -1)
+{
+    reset(seed);
+}
+
+/**
+ * @brief Clears The Grid, Then Spawns Snakes In Index Order And All Food
+ */
+void SnakeArena::reset(std::uint64_t seed)
+{
+    m_rng.reseed(seed);
+    m_owner.assign(m_cells, NoOwner);
+    m_tileFood.assign(static_cast<std::size_t>(m_tilesPerSide) * m_tilesPerSide, std::vector<int>());
+    m_tickCount = 0;
+    m_aliveCount = 0;
+    m_lastDeaths = 0;
+    m_lastHeadOnDeaths = 0;
+
+    for (int i = 0; i < snakeCount(); ++i) {
+        Snake &snake = m_snakes[i];
+        snake.rng.reseed(seed ^ (0x9E3779B97F4A7C15ull * (static_cast<std::uint64_t>(i) + 1)));
+        snake.body.reset(m_cells);
+        snake.alive = false;
+        snake.respawnIn = 0;
+        spawnSnake(i);
+    }
+    for (int slot = 0; slot < foodCount(); ++slot) {
+        m_food[slot] = -1;
+        spawnFood(slot);
+    }
+}
+
+/**
+ * @brief Lets Every Living AI Snake Choose Its Next Direction
+ *
+ * Only the grid is shared and it is not written here, so chunks of snakes
+ * can be decided on different workers. Each snake draws tie breaks from its
+ * own random stream, keeping the result independent of the thread count.
+ */
+void SnakeArena::decide(SnakeThreadPool *pool)
+{
+    const int workers = pool ? pool->threadCount() : 1;
+    if (static_cast<int>(m_scratch.size()) < workers) m_scratch.resize(workers);
+
+    if (!pool || workers == 1) {
+        for (int i = 0; i < snakeCount(); ++i) {
+            decideSnake(i, m_scratch[0]);
+        }
+        return;
+    }
+
+    const int chunk = 64;
+    const int chunks = (snakeCount() + chunk - 1) / chunk;
+    pool->run(chunks, [this, chunk](int index, int worker) {
+        int end = std::min(snakeCount(), (index + 1) * chunk);
+        for (int i = index * chunk; i < end; ++i) {
+            decideSnake(i, m_scratch[worker]);
+        }
+    });
+}
+
+/**
+ * @brief Scores The Three Forward Moves Of One AI Snake
+ *
+ * A move must stay on the grid and off every body. Among those, moves that
+ * keep at least the snake's length (up to SafetyFillLimit) of free space
+ * reachable beat tighter ones, then moves next to the head of an equal or
+ * longer snake are avoided, then the move closest to the target food wins.
+ */
+void SnakeArena::decideSnake(int index, FillScratch &scratch)
+{
+    Snake &snake = m_snakes[index];
+    if (!snake.alive || snake.player) return;
+
+    SnakeCell head = snake.body.front();
+    if (snake.target < 0 || m_owner[snake.target] != FoodOwner) {
+        snake.target = nearestFood(head);
+    }
+    SnakeCell target = snake.target >= 0 ? cellAt(snake.target) : head;
+    const int length = snake.body.size();
+    const int roomNeeded = std::min(length, SafetyFillLimit);
+
+    int bestScore = INT_MIN;
+    SnakeDirection best = snake.direction;
+    for (SnakeDirection direction : { SnakeDirection::Up, SnakeDirection::Down,
+                                      SnakeDirection::Left, SnakeDirection::Right }) {
+        if (direction == oppositeDirection(snake.direction)) continue;
+        SnakeCell delta = directionDelta(direction);
+        SnakeCell next{head.x + delta.x, head.y + delta.y};
+        if (isBlocked(next)) continue;
+
+        int score = 0;
+        int room = reachableCells(cellIndex(next), roomNeeded, scratch);
+        if (room < roomNeeded) score -= 100000 - room * 100;
+
+        // A Rival Head Next To The Cell May Claim It Too
+        for (SnakeDirection around : { SnakeDirection::Up, SnakeDirection::Down,
+                                       SnakeDirection::Left, SnakeDirection::Right }) {
+            SnakeCell offset = directionDelta(around);
+            SnakeCell cell{next.x + offset.x, next.y + offset.y};
+            if (!inBounds(cell)) continue;
+            std::uint16_t owner = m_owner[cellIndex(cell)];
+            if (!isSnake(owner) || owner == index + 1) continue;
+            const Snake &rival = m_snakes[owner - 1];
+            if (rival.body.front() == cell && rival.body.size() >= length) score -= 10000;
+        }
+
+        score -= 16 * (std::abs(target.x - next.x) + std::abs(target.y - next.y));
+        score += static_cast<int>(snake.rng.bounded(8));
+        if (score > bestScore) {
+            bestScore = score;
+            best = direction;
+        }
+    }
+    snake.intent = best;
+}
+
+/**
+ * @brief Bounded Breadth-First Fill Over Cells No Snake Covers
+ */
+int SnakeArena::reachableCells(int start, int limit, FillScratch &scratch) const
+{
+    if (scratch.stamp.size() != static_cast<std::size_t>(m_cells)) {
+        scratch.stamp.assign(m_cells, 0);
+        scratch.current = 0;
+    }
+    if (++scratch.current == 0) {
+        std::fill(scratch.stamp.begin(), scratch.stamp.end(), 0);
+        scratch.current = 1;
+    }
+
+    scratch.queue.clear();
+    scratch.queue.push_back(start);
+    scratch.stamp[start] = scratch.current;
+    for (std::size_t read = 0; read < scratch.queue.size() && static_cast<int>(scratch.queue.size()) < limit; ++read) {
+        SnakeCell cell = cellAt(scratch.queue[read]);
+        for (SnakeDirection direction : { SnakeDirection::Up, SnakeDirection::Down,
+                                          SnakeDirection::Left, SnakeDirection::Right }) {
+            SnakeCell delta = directionDelta(direction);
+            SnakeCell next{cell.x + delta.x, cell.y + delta.y};
+            if (isBlocked(next)) continue;
+            int nextIndex = cellIndex(next);
+            if (scratch.stamp[nextIndex] == scratch.current) continue;
+            scratch.stamp[nextIndex] = scratch.current;
+            scratch.queue.push_back(nextIndex);
+        }
+    }
+    return std::min(limit, static_cast<int>(scratch.queue.size()));
+}
+
+/**
+ * @brief Closest Food By Manhattan Distance, Searching Tiles Ring By Ring
+ *
+ * Once a ring has been scanned, no item in a later ring can be closer than
+ * ring * FoodTileSize cells, so the search stops as soon as the best item
+ * found is within that bound.
+ */
+int SnakeArena::nearestFood(SnakeCell cell) const
+{
+    const int tileX = cell.x / FoodTileSize;
+    const int tileY = cell.y / FoodTileSize;
+    int best = -1;
+    int bestDistance = INT_MAX;
+
+    for (int ring = 0; ring < m_tilesPerSide; ++ring) {
+        for (int y = tileY - ring; y <= tileY + ring; ++y) {
+            if (y < 0 || y >= m_tilesPerSide) continue;
+            bool edgeRow = y == tileY - ring || y == tileY + ring;
+            for (int x = tileX - ring; x <= tileX + ring; x += edgeRow ? 1 : 2 * ring) {
+                if (x >= 0 && x < m_tilesPerSide) {
+                    for (int slot : m_tileFood[static_cast<std::size_t>(y) * m_tilesPerSide + x]) {
+                        SnakeCell food = cellAt(m_food[slot]);
+                        int distance = std::abs(food.x - cell.x) + std::abs(food.y - cell.y);
+                        if (distance < bestDistance) {
+                            bestDistance = distance;
+                            best = m_food[slot];
+                        }
+                    }
+                }
+                if (ring == 0) break;
+            }
+        }
+        if (best >= 0 && bestDistance <= ring * FoodTileSize) break;
+    }
+    return best;
+}
+
+/**
+ * @brief Applies Every Snake's Intent As One Simultaneous Move
+ */
+void SnakeArena::step()
+{
+    const int count = snakeCount();
+    ++m_tickCount;
+    m_lastDeaths = 0;
+    m_lastHeadOnDeaths = 0;
+    m_moves.clear();
+    m_eats.assign(count, 0);
+    m_dies.assign(count, 0);
+    m_eatenFood.clear();
+
+    // Work Out Every New Head; Snakes About To Eat Keep Their Tail
+    for (int i = 0; i < count; ++i) {
+        Snake &snake = m_snakes[i];
+        if (!snake.alive) continue;
+        if (snake.intent != oppositeDirection(snake.direction)) {
+            snake.direction = snake.intent;
+        }
+        SnakeCell delta = directionDelta(snake.direction);
+        SnakeCell next{snake.body.front().x + delta.x, snake.body.front().y + delta.y};
+        if (!inBounds(next)) {
+            m_dies[i] = 1;
+            snake.lastResult = SnakeStepResult::HitWall;
+            continue;
+        }
+        m_moves.push_back(Move{cellIndex(next), i});
+        m_eats[i] = m_owner[cellIndex(next)] == FoodOwner;
+    }
+
+    // Vacate Tails First, So A Head May Follow Any Tail (Including Its Own) Into Its Cell
+    for (const Move &move : m_moves) {
+        Snake &snake = m_snakes[move.snake];
+        snake.previousTail = snake.body.back();
+        if (m_eats[move.snake]) continue;
+        m_owner[cellIndex(snake.body.back())] = NoOwner;
+        snake.body.popBack();
+    }
+
+    // Head-On Contests: The Longest Snake Takes The Cell, A Tie Kills Everyone In It
+    std::sort(m_moves.begin(), m_moves.end(), [](const Move &a, const Move &b) {
+        return a.cell != b.cell ? a.cell < b.cell : a.snake < b.snake;
+    });
+    for (std::size_t first = 0; first < m_moves.size();) {
+        std::size_t last = first + 1;
+        while (last < m_moves.size() && m_moves[last].cell == m_moves[first].cell) ++last;
+        if (last - first > 1) {
+            int longest = -1;
+            int winner = -1;
+            for (std::size_t j = first; j < last; ++j) {
+                int length = m_snakes[m_moves[j].snake].body.size() + (m_eats[m_moves[j].snake] ? 0 : 1);
+                if (length > longest) {
+                    longest = length;
+                    winner = m_moves[j].snake;
+                } else if (length == longest) {
+                    winner = -1;
+                }
+            }
+            for (std::size_t j = first; j < last; ++j) {
+                int loser = m_moves[j].snake;
+                if (loser == winner) continue;
+                m_dies[loser] = 1;
+                m_snakes[loser].lastResult = SnakeStepResult::HeadOn;
+                ++m_lastHeadOnDeaths;
+            }
+        }
+        first = last;
+    }
+
+    // Claim Head Cells; Every Cell Now Has At Most One Claimant, So Order Only Fixes Scores
+    for (const Move &move : m_moves) {
+        if (m_dies[move.snake]) continue;
+        Snake &snake = m_snakes[move.snake];
+        std::uint16_t owner = m_owner[move.cell];
+        if (isSnake(owner)) {
+            m_dies[move.snake] = 1;
+            snake.lastResult = owner == move.snake + 1 ? SnakeStepResult::HitSelf : SnakeStepResult::HitSnake;
+            continue;
+        }
+        if (owner == FoodOwner) {
+            for (int slot : m_tileFood[tileOf(move.cell)]) {
+                if (m_food[slot] != move.cell) continue;
+                removeFromTile(slot);
+                m_food[slot] = -1;
+                m_eatenFood.push_back(slot);
+                break;
+            }
+            ++snake.score;
+        }
+        m_owner[move.cell] = static_cast<std::uint16_t>(move.snake + 1);
+        snake.body.pushFront(cellAt(move.cell));
+        snake.lastResult = owner == FoodOwner ? SnakeStepResult::Ate : SnakeStepResult::Moved;
+    }
+
+    // Respawn Snakes That Have Waited Long Enough, Before This Tick's Dead Start Waiting
+    if (m_respawnTicks > 0) {
+        for (int i = 0; i < count; ++i) {
+            Snake &snake = m_snakes[i];
+            if (snake.alive || m_dies[i]) continue;
+            if (snake.respawnIn > 0) --snake.respawnIn;
+            if (snake.respawnIn == 0) spawnSnake(i);
+        }
+    }
+
+    for (int i = 0; i < count; ++i) {
+        if (!m_dies[i]) continue;
+        clearSnake(i);
+        m_snakes[i].alive = false;
+        m_snakes[i].respawnIn = m_respawnTicks;
+        --m_aliveCount;
+        ++m_lastDeaths;
+    }
+
+    // Replace Eaten Food, Also Retrying Items That Found No Free Cell Earlier
+    for (int slot = 0; slot < foodCount(); ++slot) {
+        if (m_food[slot] < 0) spawnFood(slot);
+    }
+}
+
+/**
+ * @brief Drops A New Snake Onto Free Cells With Room Ahead Of Its Head
+ */
+bool SnakeArena::spawnSnake(int index)
+{
+    Snake &snake = m_snakes[index];
+    for (int attempt = 0; attempt < 64; ++attempt) {
+        int cell = randomFreeCell(m_rng);
+        if (cell < 0) return false;
+        SnakeDirection direction = static_cast<SnakeDirection>(m_rng.bounded(4));
+        SnakeCell delta = directionDelta(direction);
+        SnakeCell head = cellAt(cell);
+
+        // The Body Trails Behind The Head And The Cell Ahead Must Be Free Too
+        bool fits = true;
+        for (int i = -1; i < StartLength && fits; ++i) {
+            SnakeCell part{head.x - delta.x * i, head.y - delta.y * i};
+            fits = inBounds(part) && m_owner[cellIndex(part)] == NoOwner;
+        }
+        if (!fits) continue;
+
+        snake.body.clear();
+        for (int i = 0; i < StartLength; ++i) {
+            SnakeCell part{head.x - delta.x * i, head.y - delta.y * i};
+            m_owner[cellIndex(part)] = static_cast<std::uint16_t>(index + 1);
+            snake.body.pushBack(part);
+        }
+        snake.previousTail = snake.body.back();
+        snake.direction = direction;
+        snake.intent = direction;
+        snake.lastResult = SnakeStepResult::Moved;
+        snake.alive = true;
+        snake.score = 0;
+        snake.target = -1;
+        ++m_aliveCount;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Frees Every Cell Of A Snake's Body
+ */
+void SnakeArena::clearSnake(int index)
+{
+    Snake &snake = m_snakes[index];
+    for (const SnakeCell &cell : snake.body) {
+        int cellIndex = this->cellIndex(cell);
+        if (m_owner[cellIndex] == index + 1) m_owner[cellIndex] = NoOwner;
+    }
+    snake.body.clear();
+}
+
+/**
+ * @brief Places One Food Item And Files It Under Its Tile
+ */
+bool SnakeArena::spawnFood(int slot)
+{
+    int cell = randomFreeCell(m_rng);
+    if (cell < 0) return false;
+    m_food[slot] = cell;
+    m_owner[cell] = FoodOwner;
+    addToTile(slot);
+    return true;
+}
+
+/**
+ * @brief Random Probes, Then A Wrapping Scan From A Random Cell
+ *
+ * With hundreds of short snakes most of the grid is free, so a probe nearly
+ * always succeeds; the scan only matters on a crowded grid.
+ */
+int SnakeArena::randomFreeCell(SnakeRandom &rng) const
+{
+    for (int probe = 0; probe < 32; ++probe) {
+        int cell = static_cast<int>(rng.bounded(static_cast<std::uint32_t>(m_cells)));
+        if (m_owner[cell] == NoOwner) return cell;
+    }
+    int start = static_cast<int>(rng.bounded(static_cast<std::uint32_t>(m_cells)));
+    for (int i = 0; i < m_cells; ++i) {
+        int cell = start + i < m_cells ? start + i : start + i - m_cells;
+        if (m_owner[cell] == NoOwner) return cell;
+    }
+    return -1;
+}
+
+/**
+ * @brief Appends A Food Slot To Its Tile's List
+ */
+void SnakeArena::addToTile(int slot)
+{
+    std::vector<int> &tile = m_tileFood[tileOf(m_food[slot])];
+    m_foodTileSlot[slot] = static_cast<int>(tile.size());
+    tile.push_back(slot);
+}
+
+/**
+ * @brief Removes A Food Slot From Its Tile's List By Swapping In The Last Entry
+ */
+void SnakeArena::removeFromTile(int slot)
+{
+    std::vector<int> &tile = m_tileFood[tileOf(m_food[slot])];
+    int position = m_foodTileSlot[slot];
+    tile[position] = tile.back();
+    m_foodTileSlot[tile[position]] = position;
+    tile.pop_back();
+    m_foodTileSlot[slot] = -1;
+}
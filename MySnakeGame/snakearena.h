@@ -0,0 +1,190 @@
+#ifndef SNAKEARENA_H
+#define SNAKEARENA_H
+
+// Standard Library Only - Shared By The Headless Tools
+#include "snakebody.h"
+#include "snakerandom.h"
+#include "snaketypes.h"
+#include <cstdint>
+#include <vector>
+
+class SnakeThreadPool;
+
+// Many Snakes, Player And AI, Sharing One Grid With Several Food Items
+//
+// Every cell holds the ID of what covers it (NoOwner, FoodOwner or 1 + the
+// snake index), so any collision or AI probe is one array read however many
+// snakes there are. Food is additionally bucketed into coarse tiles so an AI
+// finds the nearest item by scanning a few tiles instead of every item.
+//
+// A tick runs in two phases. decide() lets every AI snake pick a direction
+// from the unchanged grid; it only reads shared state, so it can be split
+// across a thread pool and still give the same result. step() then applies
+// all moves together in a fixed order:
+//   1. tails of snakes that are not about to eat are vacated,
+//   2. heads aiming at the same cell are resolved - the longest snake takes
+//      it, equal lengths all die,
+//   3. each surviving head claims its cell in snake order; hitting any body
+//      (a head's previous cell is still body) kills the mover,
+//   4. dead bodies are cleared, eaten food is replaced and dead snakes wait
+//      respawnTicks() before re-entering.
+// The outcome depends only on the seed and the player's inputs.
+class SnakeArena
+{
+public:
+    // Cell Owner Values; Snake i Is Stored As i + 1
+    static constexpr std::uint16_t NoOwner = 0;
+    static constexpr std::uint16_t FoodOwner = 0xFFFF;
+    static constexpr int MaxSnakes = 0xFFFE;
+
+    // Length Of A Freshly Spawned Snake
+    static constexpr int StartLength = 3;
+
+    // Side Of The Square Tiles Food Is Bucketed Into
+    static constexpr int FoodTileSize = 16;
+
+    // Largest Region An AI Flood Fills Before Accepting A Move As Safe
+    static constexpr int SafetyFillLimit = 48;
+
+    // One Snake's State
+    struct Snake
+    {
+        SnakeBody body;                 // Segments, Head First
+        SnakeCell previousTail{0, 0};   // Tail Before The Last Tick (For Interpolation)
+        SnakeDirection direction = SnakeDirection::Right;
+        SnakeDirection intent = SnakeDirection::Right;  // Direction The Next step() Applies
+        SnakeStepResult lastResult = SnakeStepResult::Moved;
+        bool alive = false;
+        bool player = false;            // Steered Through setDirection(), Skipped By decide()
+        int score = 0;                  // Food Eaten Since The Last Spawn
+        int respawnIn = 0;              // Ticks Until A Dead Snake Re-Enters
+        int target = -1;                // Cell Index Of The Food The AI Is Heading For
+        SnakeRandom rng;                // Per-Snake Stream So decide() Is Thread-Order Free
+    };
+
+    // Create An Arena, Snake i Seeded From seed And i
+    SnakeArena(int gridSize, int snakeCount, int foodCount, std::uint64_t seed);
+
+    // Clear The Grid And Spawn Every Snake And Food Item Again
+    void reset(std::uint64_t seed);
+
+    // Hand A Snake To The Player (Or Back To The AI)
+    void setPlayerControlled(int snake, bool player) { m_snakes[snake].player = player; }
+
+    // Player Input, Applied By The Next step(). Reversals Are Ignored Like In SnakeEngine
+    void setDirection(int snake, SnakeDirection direction) { m_snakes[snake].intent = direction; }
+
+    // Ticks A Dead Snake Waits Before Respawning, 0 Keeps It Dead
+    void setRespawnTicks(int ticks) { m_respawnTicks = ticks < 0 ? 0 : ticks; }
+    int respawnTicks() const { return m_respawnTicks; }
+
+    // Phase One: Every Living AI Snake Picks Its Intent, On pool When Given
+    void decide(SnakeThreadPool *pool = nullptr);
+
+    // Phase Two: Apply All Intents At Once
+    void step();
+
+    // Both Phases
+    void tick(SnakeThreadPool *pool = nullptr)
+    {
+        decide(pool);
+        step();
+    }
+
+    // Arena State Accessors
+    int gridSize() const { return m_gridSize; }
+    int snakeCount() const { return static_cast<int>(m_snakes.size()); }
+    int foodCount() const { return static_cast<int>(m_food.size()); }
+    int aliveCount() const { return m_aliveCount; }
+    std::uint64_t tickCount() const { return m_tickCount; }
+    const Snake &snake(int index) const { return m_snakes[index]; }
+    SnakeCell food(int index) const { return cellAt(m_food[index]); }
+
+    // What Covers A Cell: NoOwner, FoodOwner Or 1 + Snake Index
+    std::uint16_t owner(SnakeCell cell) const { return m_owner[cellIndex(cell)]; }
+
+    // Outside The Grid Or Covered By Any Snake
+    bool isBlocked(SnakeCell cell) const
+    {
+        return !inBounds(cell) || isSnake(m_owner[cellIndex(cell)]);
+    }
+
+    // Deaths Of The Last Tick, Head-On Contests Counted Separately
+    int lastDeaths() const { return m_lastDeaths; }
+    int lastHeadOnDeaths() const { return m_lastHeadOnDeaths; }
+
+private:
+    // Per-Worker Flood Fill Scratch: A Stamp Per Cell Avoids Clearing Between Fills
+    struct FillScratch
+    {
+        std::vector<std::uint32_t> stamp;
+        std::uint32_t current = 0;
+        std::vector<int> queue;
+    };
+
+    // A Head Moving This Tick
+    struct Move
+    {
+        int cell;
+        int snake;
+    };
+
+    bool inBounds(SnakeCell cell) const
+    {
+        return cell.x >= 0 && cell.x < m_gridSize && cell.y >= 0 && cell.y < m_gridSize;
+    }
+    int cellIndex(SnakeCell cell) const { return cell.y * m_gridSize + cell.x; }
+    SnakeCell cellAt(int index) const { return SnakeCell{index % m_gridSize, index / m_gridSize}; }
+    static bool isSnake(std::uint16_t owner) { return owner != NoOwner && owner != FoodOwner; }
+
+    // Choose One AI Snake's Direction
+    void decideSnake(int index, FillScratch &scratch);
+
+    // Free Cells Reachable From start Through Unowned Cells, Counted Up To limit
+    int reachableCells(int start, int limit, FillScratch &scratch) const;
+
+    // Nearest Food To cell By Scanning Food Tiles In Growing Rings, -1 When There Is None
+    int nearestFood(SnakeCell cell) const;
+
+    // Place A Snake Of StartLength On A Random Straight Run Of Free Cells, false If None Found
+    bool spawnSnake(int index);
+
+    // Release Every Cell Of A Snake
+    void clearSnake(int index);
+
+    // Put Food Slot slot On A Random Free Cell
+    bool spawnFood(int slot);
+
+    // Random Free Cell, -1 When None Is Found
+    int randomFreeCell(SnakeRandom &rng) const;
+
+    // Food Tile Bookkeeping
+    int tileOf(int cell) const { return (cellAt(cell).y / FoodTileSize) * m_tilesPerSide + cellAt(cell).x / FoodTileSize; }
+    void addToTile(int slot);
+    void removeFromTile(int slot);
+
+    int m_gridSize;
+    int m_cells;                        // gridSize * gridSize
+    int m_tilesPerSide;                 // Food Tiles Per Row And Column
+    int m_respawnTicks;
+    int m_aliveCount;
+    int m_lastDeaths;
+    int m_lastHeadOnDeaths;
+    std::uint64_t m_tickCount;
+    SnakeRandom m_rng;                  // Food And Spawn Placement
+
+    std::vector<std::uint16_t> m_owner; // One Owner ID Per Cell
+    std::vector<Snake> m_snakes;
+    std::vector<int> m_food;            // Cell Index Of Each Food Item, -1 While Unplaced
+    std::vector<std::vector<int>> m_tileFood;  // Food Slots Per Tile
+    std::vector<int> m_foodTileSlot;    // Position Of Each Food Slot In Its Tile's List
+
+    // step() Scratch, Kept To Avoid Per-Tick Allocation
+    std::vector<Move> m_moves;
+    std::vector<std::uint8_t> m_eats;
+    std::vector<std::uint8_t> m_dies;
+    std::vector<int> m_eatenFood;
+    std::vector<FillScratch> m_scratch; // One Per decide() Worker
+};
+
+#endif // SNAKEARENA_H
@@ -0,0 +1,508 @@
+#include "snakeautopilot.h"
+#include "snakemcts.h"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+
+namespace {
+
+const SnakeDirection AllDirections[] = {
+    SnakeDirection::Up, SnakeDirection::Down, SnakeDirection::Left, SnakeDirection::Right
+};
+
+}
+
+/**
+ * @brief Creates A Strategy Instance
+ * @param kind Strategy To Create
+ * @param threadCount Search Threads Of Parallel Strategies, 0 For One Per Hardware Thread
+ */
+std::unique_ptr<SnakeStrategy> createSnakeStrategy(SnakeAutopilotKind kind, int threadCount)
+{
+    switch (kind) {
+    case SnakeAutopilotKind::GreedyBfs:   return std::make_unique<GreedyBfsStrategy>();
+    case SnakeAutopilotKind::AStar:       return std::make_unique<AStarStrategy>();
+    case SnakeAutopilotKind::Hamiltonian: return std::make_unique<HamiltonianStrategy>();
+    case SnakeAutopilotKind::Mcts:        return std::make_unique<MctsStrategy>(threadCount);
+    }
+    return std::make_unique<AStarStrategy>();
+}
+
+/**
+ * @brief Neighbouring Cell Index, -1 When The Move Leaves The Grid
+ */
+int SnakeGrid::neighbour(int cellIndex, SnakeDirection direction, int gridSize)
+{
+    int x = cellIndex % gridSize;
+    int y = cellIndex / gridSize;
+    SnakeCell delta = directionDelta(direction);
+    x += delta.x;
+    y += delta.y;
+    if (x < 0 || x >= gridSize || y < 0 || y >= gridSize) return -1;
+    return y * gridSize + x;
+}
+
+/**
+ * @brief Direction Of The Move Between Two Adjacent Cells
+ */
+SnakeDirection SnakeGrid::directionBetween(int from, int to, int gridSize)
+{
+    int delta = to - from;
+    if (delta == 1) return SnakeDirection::Right;
+    if (delta == -1) return SnakeDirection::Left;
+    if (delta == gridSize) return SnakeDirection::Down;
+    return SnakeDirection::Up;
+}
+
+/**
+ * @brief Fills A Byte Per Cell Map With The Map Walls, All Free On The Open Board
+ */
+void SnakeGrid::wallMap(const SnakeEngine &engine, std::vector<std::uint8_t> &blocked)
+{
+    int gridSize = engine.gridSize();
+    blocked.assign(static_cast<size_t>(gridSize) * gridSize, 0);
+    if (const SnakeMap *map = engine.map()) {
+        for (int y = 0; y < gridSize; ++y) {
+            for (int x = 0; x < gridSize; ++x) {
+                blocked[y * gridSize + x] = map->isWall(SnakeCell{x, y}) ? 1 : 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Fills A Byte Per Cell Map Of Cells The Head Cannot Enter Next Tick
+ */
+void SnakeGrid::blockedMap(const SnakeEngine &engine, std::vector<std::uint8_t> &blocked)
+{
+    int gridSize = engine.gridSize();
+    wallMap(engine, blocked);
+
+    const SnakeBody &body = engine.body();
+    int last = body.size() - 1;
+    for (int i = 0; i < last; ++i) {
+        blocked[body[i].y * gridSize + body[i].x] = 1;
+    }
+}
+
+/**
+ * @brief Picks The Free Neighbour Leading Into The Largest Open Area
+ */
+SnakeDirection SnakeGrid::safestDirection(const SnakeEngine &engine, const std::vector<std::uint8_t> &blocked,
+                                          SnakeGridSearch &search)
+{
+    int gridSize = engine.gridSize();
+    int head = engine.head().y * gridSize + engine.head().x;
+    int cells = gridSize * gridSize;
+
+    SnakeDirection best = engine.direction();
+    int bestArea = -1;
+    for (SnakeDirection direction : AllDirections) {
+        int next = neighbour(head, direction, gridSize);
+        if (next < 0 || blocked[next]) continue;
+        int area = search.reachableCount(blocked, next, cells);
+        if (area > bestArea) {
+            bestArea = area;
+            best = direction;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Sizes Scratch Buffers For A Grid
+ */
+void SnakeGridSearch::prepare(int gridSize)
+{
+    if (gridSize == m_gridSize) return;
+
+    size_t cells = static_cast<size_t>(gridSize) * gridSize;
+    m_gridSize = gridSize;
+    m_generation = 0;
+    m_visited.assign(cells, 0);
+    m_parent.assign(cells, -1);
+    m_cost.assign(cells, 0);
+    m_queue.assign(cells, 0);
+    m_heap.clear();
+    m_heap.reserve(cells * 2);
+}
+
+/**
+ * @brief Advances The Visited Stamp, Clearing Stamps Only On Wrap Around
+ */
+void SnakeGridSearch::nextGeneration()
+{
+    if (++m_generation == 0) {
+        std::fill(m_visited.begin(), m_visited.end(), 0);
+        m_generation = 1;
+    }
+}
+
+/**
+ * @brief Breadth First Search From start To goal
+ * @return First Cell On A Shortest Path, Or -1 When goal Is Unreachable
+ */
+int SnakeGridSearch::bfsFirstStep(const std::vector<std::uint8_t> &blocked, int start, int goal)
+{
+    if (start == goal) return -1;
+
+    nextGeneration();
+    int head = 0;
+    int tail = 0;
+    m_queue[tail++] = start;
+    m_visited[start] = m_generation;
+    m_parent[start] = -1;
+
+    while (head < tail) {
+        int cell = m_queue[head++];
+        for (SnakeDirection direction : AllDirections) {
+            int next = SnakeGrid::neighbour(cell, direction, m_gridSize);
+            if (next < 0 || m_visited[next] == m_generation) continue;
+            if (blocked[next] && next != goal) continue;
+
+            m_visited[next] = m_generation;
+            m_parent[next] = cell;
+            if (next == goal) {
+                // Walk Back To The Cell Adjacent To start
+                int step = next;
+                while (m_parent[step] != start) {
+                    step = m_parent[step];
+                }
+                return step;
+            }
+            m_queue[tail++] = next;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief A* Search With Manhattan Heuristic, Or Landmark Bounds When A Map Has Fields
+ *
+ * On a walled map the landmark bound is usually much closer to the real
+ * distance than Manhattan, so far fewer cells are expanded; it also proves
+ * a goal in another region unreachable without searching at all.
+ * @param path Receives The Cells From start (Exclusive) To goal (Inclusive)
+ * @return Path Length, Or -1 When goal Is Unreachable
+ */
+int SnakeGridSearch::aStarPath(const std::vector<std::uint8_t> &blocked, int start, int goal, std::vector<int> &path)
+{
+    path.clear();
+    if (start == goal) return -1;
+
+    int goalX = goal % m_gridSize;
+    int goalY = goal / m_gridSize;
+    const SnakeMapFields *fields = m_fields && m_fields->gridSize() == m_gridSize ? m_fields : nullptr;
+    auto heuristic = [&](int cell) {
+        if (fields) return std::max(0, fields->lowerBound(cell, goal));
+        return std::abs(cell % m_gridSize - goalX) + std::abs(cell / m_gridSize - goalY);
+    };
+    if (fields && fields->lowerBound(start, goal) < 0) return -1;
+
+    nextGeneration();
+    m_heap.clear();
+    m_visited[start] = m_generation;
+    m_cost[start] = 0;
+    m_parent[start] = -1;
+    m_heap.push_back((std::uint64_t(heuristic(start)) << 32) | std::uint32_t(start));
+
+    std::greater<std::uint64_t> minFirst;
+    while (!m_heap.empty()) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), minFirst);
+        std::uint64_t entry = m_heap.back();
+        m_heap.pop_back();
+
+        int cell = static_cast<int>(entry & 0xffffffffu);
+        int estimate = static_cast<int>(entry >> 32);
+        int cost = m_cost[cell];
+
+        // Skip Stale Heap Entries Left Behind By A Cheaper Update
+        if (estimate != cost + heuristic(cell)) continue;
+
+        if (cell == goal) {
+            for (int step = goal; step != start; step = m_parent[step]) {
+                path.push_back(step);
+            }
+            std::reverse(path.begin(), path.end());
+            return static_cast<int>(path.size());
+        }
+
+        for (SnakeDirection direction : AllDirections) {
+            int next = SnakeGrid::neighbour(cell, direction, m_gridSize);
+            if (next < 0) continue;
+            if (blocked[next] && next != goal) continue;
+
+            int nextCost = cost + 1;
+            if (m_visited[next] == m_generation && m_cost[next] <= nextCost) continue;
+
+            m_visited[next] = m_generation;
+            m_cost[next] = nextCost;
+            m_parent[next] = cell;
+            m_heap.push_back((std::uint64_t(nextCost + heuristic(next)) << 32) | std::uint32_t(next));
+            std::push_heap(m_heap.begin(), m_heap.end(), minFirst);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Counts Cells Reachable From start Through Free Cells
+ * @param limit Stop Counting Once This Many Cells Were Found
+ */
+int SnakeGridSearch::reachableCount(const std::vector<std::uint8_t> &blocked, int start, int limit)
+{
+    nextGeneration();
+    int head = 0;
+    int tail = 0;
+    m_queue[tail++] = start;
+    m_visited[start] = m_generation;
+
+    while (head < tail && tail < limit) {
+        int cell = m_queue[head++];
+        for (SnakeDirection direction : AllDirections) {
+            int next = SnakeGrid::neighbour(cell, direction, m_gridSize);
+            if (next < 0 || blocked[next] || m_visited[next] == m_generation) continue;
+            m_visited[next] = m_generation;
+            m_queue[tail++] = next;
+        }
+    }
+    return tail;
+}
+
+/**
+ * @brief Shortest Path To Food, Falling Back To The Largest Open Area
+ */
+SnakeDirection GreedyBfsStrategy::decide(const SnakeEngine &engine)
+{
+    int gridSize = engine.gridSize();
+    m_search.prepare(gridSize);
+    SnakeGrid::blockedMap(engine, m_blocked);
+
+    int head = engine.head().y * gridSize + engine.head().x;
+    if (engine.hasFood()) {
+        int food = engine.food().y * gridSize + engine.food().x;
+        int step = m_search.bfsFirstStep(m_blocked, head, food);
+        if (step >= 0) {
+            return SnakeGrid::directionBetween(head, step, gridSize);
+        }
+    }
+    return SnakeGrid::safestDirection(engine, m_blocked, m_search);
+}
+
+/**
+ * @brief A* To Food When Safe, Otherwise Follow The Tail To Buy Time
+ */
+SnakeDirection AStarStrategy::decide(const SnakeEngine &engine)
+{
+    int gridSize = engine.gridSize();
+    m_search.prepare(gridSize);
+    m_search.setFields(engine.map() ? engine.map()->fields() : nullptr);
+    SnakeGrid::blockedMap(engine, m_blocked);
+
+    int head = engine.head().y * gridSize + engine.head().x;
+    if (engine.hasFood()) {
+        int food = engine.food().y * gridSize + engine.food().x;
+        if (m_search.aStarPath(m_blocked, head, food, m_path) > 0 && tailReachableAfter(engine, m_path, true)) {
+            return SnakeGrid::directionBetween(head, m_path.front(), gridSize);
+        }
+    }
+
+    // Food Is Not Safe Yet: Wander Away From It On A Move That Keeps The Tail Reachable,
+    // Which Reshapes The Body Until A Safe Path Opens. Without Food (engine.food() Is Stale
+    // Then) There Is Nothing To Avoid, So The Move Opening Onto The Most Space Wins
+    int food = engine.hasFood() ? engine.food().y * gridSize + engine.food().x : -1;
+    int bestCell = -1;
+    int bestScore = -1;
+    for (SnakeDirection direction : AllDirections) {
+        int next = SnakeGrid::neighbour(head, direction, gridSize);
+        if (next < 0 || m_blocked[next]) continue;
+
+        m_path.assign(1, next);
+        if (!tailReachableAfter(engine, m_path, next == food)) continue;
+
+        int score = food >= 0 ? std::abs(next % gridSize - food % gridSize) + std::abs(next / gridSize - food / gridSize)
+                              : m_search.reachableCount(m_blocked, next, gridSize * gridSize);
+        if (score > bestScore) {
+            bestScore = score;
+            bestCell = next;
+        }
+    }
+    if (bestCell >= 0) {
+        return SnakeGrid::directionBetween(head, bestCell, gridSize);
+    }
+    return SnakeGrid::safestDirection(engine, m_blocked, m_search);
+}
+
+/**
+ * @brief Simulates Following A Path To Food And Checks The Tail Stays Reachable
+ */
+bool AStarStrategy::tailReachableAfter(const SnakeEngine &engine, const std::vector<int> &path, bool eats)
+{
+    int gridSize = engine.gridSize();
+    const SnakeBody &body = engine.body();
+
+    // Virtual Body Stored Tail First So Moving Is push_back Plus Advancing The Tail; Walls Stay Blocked
+    m_virtualBody.clear();
+    SnakeGrid::wallMap(engine, m_virtualBlocked);
+    for (int i = body.size() - 1; i >= 0; --i) {
+        int cell = body[i].y * gridSize + body[i].x;
+        m_virtualBody.push_back(cell);
+        m_virtualBlocked[cell] = 1;
+    }
+
+    size_t tailPos = 0;
+    size_t last = path.size() - 1;
+    for (size_t i = 0; i < path.size(); ++i) {
+        // Eating On The Final Step Keeps The Tail In Place
+        if (i != last || !eats) {
+            m_virtualBlocked[m_virtualBody[tailPos++]] = 0;
+        }
+        if (m_virtualBlocked[path[i]]) return false;
+        m_virtualBlocked[path[i]] = 1;
+        m_virtualBody.push_back(path[i]);
+    }
+
+    // Every Free Cell Is Filled After Eating - Nothing Left To Reach
+    size_t freeCells = engine.map() ? static_cast<size_t>(engine.map()->freeCellCount())
+                                    : static_cast<size_t>(gridSize) * gridSize;
+    if (m_virtualBody.size() - tailPos >= freeCells) return true;
+
+    int newHead = m_virtualBody.back();
+    int newTail = m_virtualBody[tailPos];
+    m_virtualBlocked[newTail] = 0;
+    return m_search.bfsFirstStep(m_virtualBlocked, newHead, newTail) >= 0;
+}
+
+/**
+ * @brief Builds The Serpentine Cycle For An Even Grid
+ *
+ * Column 0 is the return lane and the remaining columns are swept row by
+ * row. The cycle is mirrored vertically when needed so the starting row is
+ * swept left to right, matching the snake's initial heading.
+ */
+void HamiltonianStrategy::buildCycle(int gridSize)
+{
+    m_gridSize = gridSize;
+    m_map = nullptr;
+    m_order.clear();
+    m_next.clear();
+    m_cycleLength = 0;
+    if (gridSize % 2 != 0) return;
+
+    int cells = gridSize * gridSize;
+    m_cycleLength = cells;
+    bool mirrored = (gridSize / 2) % 2 != 0;
+    m_order.assign(cells, 0);
+    m_next.assign(cells, 0);
+
+    std::vector<int> sequence;
+    sequence.reserve(cells);
+    int x = 0;
+    int y = 0;
+    for (int step = 0; step < cells; ++step) {
+        sequence.push_back((mirrored ? gridSize - 1 - y : y) * gridSize + x);
+        if (x == 0) {
+            if (y == 0) ++x; else --y;
+        } else if (y % 2 == 0) {
+            if (x < gridSize - 1) ++x; else ++y;
+        } else if (x > 1 || y == gridSize - 1) {
+            --x;
+        } else {
+            ++y;
+        }
+    }
+
+    for (int i = 0; i < cells; ++i) {
+        m_order[sequence[i]] = i;
+        m_next[sequence[i]] = sequence[(i + 1) % cells];
+    }
+}
+
+/**
+ * @brief Copies A Map's Precomputed Cycle, Walls Being Off The Cycle
+ *
+ * A cycle over walls cannot be derived on the fly like the serpentine, so
+ * without cached fields (or when the map has no block cycle) the strategy
+ * falls back to A*.
+ */
+void HamiltonianStrategy::loadCycle(const SnakeMap *map)
+{
+    m_gridSize = map->gridSize();
+    m_map = map;
+    m_order.clear();
+    m_next.clear();
+    m_cycleLength = 0;
+
+    const SnakeMapFields *fields = map->fields();
+    if (!fields || !fields->hasCycle() || fields->gridSize() != m_gridSize) return;
+
+    int cells = m_gridSize * m_gridSize;
+    m_order.resize(cells);
+    m_next.resize(cells);
+    for (int cell = 0; cell < cells; ++cell) {
+        m_order[cell] = fields->cycleOrder(cell);
+        m_next[cell] = fields->cycleNext(cell);
+    }
+    m_cycleLength = fields->cycleLength();
+}
+
+/**
+ * @brief Follows The Cycle, Cutting Ahead Only While The Cut Cannot Reach The Tail
+ */
+SnakeDirection HamiltonianStrategy::decide(const SnakeEngine &engine)
+{
+    int gridSize = engine.gridSize();
+    if (engine.map() != m_map || gridSize != m_gridSize) {
+        if (engine.map()) {
+            loadCycle(engine.map());
+        } else {
+            buildCycle(gridSize);
+        }
+    }
+    if (m_order.empty()) return m_fallback.decide(engine);
+
+    int cells = m_cycleLength;
+    int head = engine.head().y * gridSize + engine.head().x;
+    int tail = engine.tail().y * gridSize + engine.tail().x;
+    int length = engine.length();
+    int next = m_next[head];
+
+    // Off The Cycle (Start Position Or After A Fallback Move) - Let A* Recover
+    SnakeCell nextCell{next % gridSize, next / gridSize};
+    if (engine.isBlocked(nextCell) && nextCell != engine.tail()) {
+        return m_fallback.decide(engine);
+    }
+
+    int distanceToTail = cycleDistance(head, tail);
+    int distanceToFood = engine.hasFood()
+                             ? cycleDistance(head, engine.food().y * gridSize + engine.food().x)
+                             : 0;
+
+    // Budget Of Cells We May Skip Without Overrunning The Tail, With A Safety Margin
+    int emptyCells = cells - length - 1;
+    int cutting = distanceToTail - length - 3;
+    if (emptyCells < cells / 2) {
+        cutting = 0;
+    } else if (distanceToFood < distanceToTail) {
+        cutting -= 1;
+        if ((distanceToTail - distanceToFood) * 4 > emptyCells) {
+            cutting -= 10;
+        }
+    }
+    cutting = std::max(0, std::min(cutting, distanceToFood));
+
+    int best = next;
+    int bestDistance = 0;
+    for (SnakeDirection direction : AllDirections) {
+        int candidate = SnakeGrid::neighbour(head, direction, gridSize);
+        if (candidate < 0) continue;
+        if (engine.isBlocked(SnakeCell{candidate % gridSize, candidate / gridSize})) continue;
+
+        int distance = cycleDistance(head, candidate);
+        if (distance <= cutting && distance > bestDistance) {
+            best = candidate;
+            bestDistance = distance;
+        }
+    }
+    return SnakeGrid::directionBetween(head, best, gridSize);
+}
@@ -0,0 +1,152 @@
+#ifndef SNAKEAUTOPILOT_H
+#define SNAKEAUTOPILOT_H
+
+#include "snakeengine.h"
+#include "snakemapfields.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Available Autopilot Strategies
+enum class SnakeAutopilotKind {
+    GreedyBfs,      // Shortest Path To Food, No Lookahead
+    AStar,          // A* To Food, Only Taken When The Tail Stays Reachable
+    Hamiltonian,    // Precomputed Cycle With Safe Shortcuts
+    Mcts            // Multithreaded Monte Carlo Tree Search Over Engine Checkpoints
+};
+
+// Pluggable Policy Choosing The Next Direction From Engine State
+class SnakeStrategy
+{
+public:
+    virtual ~SnakeStrategy() = default;
+
+    // Human Readable Strategy Name For Menus And Benchmarks
+    virtual const char *name() const = 0;
+
+    // Choose The Direction For The Next Tick
+    virtual SnakeDirection decide(const SnakeEngine &engine) = 0;
+};
+
+// Create A Strategy Instance. threadCount Limits Strategies That Search In Parallel (MCTS),
+// 0 Uses Every Hardware Thread; Pass 1 When The Caller Already Runs Games In Parallel
+std::unique_ptr<SnakeStrategy> createSnakeStrategy(SnakeAutopilotKind kind, int threadCount = 0);
+
+// Grid Search Scratch Space Shared By The Path Finding Strategies
+//
+// Buffers are sized once per grid and reused; visited marks use a generation
+// counter so a new search never has to clear the grid.
+class SnakeGridSearch
+{
+public:
+    // Size Scratch Buffers For A Grid
+    void prepare(int gridSize);
+
+    // Breadth First Search, Returns First Step Toward goal Or -1 If Unreachable
+    int bfsFirstStep(const std::vector<std::uint8_t> &blocked, int start, int goal);
+
+    // Use A Map's Landmark Fields As The A* Heuristic (nullptr: Manhattan Only)
+    void setFields(const SnakeMapFields *fields) { m_fields = fields; }
+
+    // A* With Manhattan (Or Landmark) Heuristic, Fills path (start Excluded) And Returns Its Length Or -1
+    int aStarPath(const std::vector<std::uint8_t> &blocked, int start, int goal, std::vector<int> &path);
+
+    // Count Cells Reachable From start (Flood Fill), Stopping Once limit Is Reached
+    int reachableCount(const std::vector<std::uint8_t> &blocked, int start, int limit);
+
+    int gridSize() const { return m_gridSize; }
+
+private:
+    // Start A New Search Generation
+    void nextGeneration();
+
+    int m_gridSize = 0;
+    const SnakeMapFields *m_fields = nullptr;  // Landmark Bounds For The Current Map
+    std::uint32_t m_generation = 0;
+    std::vector<std::uint32_t> m_visited;   // Generation Stamp Per Cell
+    std::vector<int> m_parent;              // Predecessor Per Cell
+    std::vector<int> m_cost;                // Path Cost Per Cell (A*)
+    std::vector<int> m_queue;               // BFS Queue
+    std::vector<std::uint64_t> m_heap;      // A* Open Set, (f << 32) | cell
+};
+
+// Helpers Shared By Strategies
+namespace SnakeGrid {
+    // Neighbour Of cellIndex In direction, -1 When Outside The Grid
+    int neighbour(int cellIndex, SnakeDirection direction, int gridSize);
+
+    // Direction Moving From One Adjacent Cell To Another
+    SnakeDirection directionBetween(int from, int to, int gridSize);
+
+    // Byte Per Cell Map Holding Only The Engine's Map Walls (1 = Wall)
+    void wallMap(const SnakeEngine &engine, std::vector<std::uint8_t> &blocked);
+
+    // Blocked Map Of The Engine (1 = Wall Or Snake Body), Tail Counted Free Because It Moves Away
+    void blockedMap(const SnakeEngine &engine, std::vector<std::uint8_t> &blocked);
+
+    // Safest Fallback: The Free Neighbour With The Largest Reachable Area
+    SnakeDirection safestDirection(const SnakeEngine &engine, const std::vector<std::uint8_t> &blocked,
+                                   SnakeGridSearch &search);
+}
+
+// Greedy Breadth First Search Straight To The Food
+class GreedyBfsStrategy : public SnakeStrategy
+{
+public:
+    const char *name() const override { return "greedy-bfs"; }
+    SnakeDirection decide(const SnakeEngine &engine) override;
+
+private:
+    SnakeGridSearch m_search;
+    std::vector<std::uint8_t> m_blocked;
+};
+
+// A* To The Food, Verified By Simulating The Path And Checking The Tail Is Still Reachable
+class AStarStrategy : public SnakeStrategy
+{
+public:
+    const char *name() const override { return "astar"; }
+    SnakeDirection decide(const SnakeEngine &engine) override;
+
+private:
+    // Simulate Following path (Eating On The Last Step When eats Is Set) And Report
+    // Whether The New Head Can Still Reach The Tail
+    bool tailReachableAfter(const SnakeEngine &engine, const std::vector<int> &path, bool eats);
+
+    SnakeGridSearch m_search;
+    std::vector<std::uint8_t> m_blocked;
+    std::vector<std::uint8_t> m_virtualBlocked;
+    std::vector<int> m_virtualBody;
+    std::vector<int> m_path;
+};
+
+// Hamiltonian Cycle Follower That Takes Shortcuts Which Cannot Trap The Snake
+class HamiltonianStrategy : public SnakeStrategy
+{
+public:
+    const char *name() const override { return "hamiltonian"; }
+    SnakeDirection decide(const SnakeEngine &engine) override;
+
+private:
+    // Precompute Cycle Order For An Even Grid, Oriented So The Start Row Runs With The Snake
+    void buildCycle(int gridSize);
+
+    // Take The Cycle Of A Map From Its Cached Fields (Empty When It Has None)
+    void loadCycle(const SnakeMap *map);
+
+    // Distance Travelling Forward Along The Cycle
+    int cycleDistance(int from, int to) const
+    {
+        int distance = m_order[to] - m_order[from];
+        return distance < 0 ? distance + m_cycleLength : distance;
+    }
+
+    int m_gridSize = 0;
+    const SnakeMap *m_map = nullptr;    // Map The Cycle Was Built For, nullptr For The Empty Board
+    int m_cycleLength = 0;              // Cells On The Cycle, Fewer Than The Grid With Walls
+    std::vector<int> m_order;           // Position Of Each Cell Along The Cycle
+    std::vector<int> m_next;            // Next Cell Along The Cycle
+    AStarStrategy m_fallback;           // Used On Odd Grids And Maps Without A Cycle
+};
+
+#endif // SNAKEAUTOPILOT_H
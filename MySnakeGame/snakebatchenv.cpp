@@ -0,0 +1,233 @@
+#include "snakebatchenv.h"
+#include "snakefreecells.h"
+#include <algorithm>
+
+namespace {
+
+// The Map To Play, Or Null When It Is Invalid Or Too Large For The Batch
+std::shared_ptr<const SnakeMap> acceptedMap(std::shared_ptr<const SnakeMap> map)
+{
+    if (!map || !map->isValid() || map->gridSize() > BatchSnakeEnv::MaxGridSize) return nullptr;
+    return map;
+}
+
+// Applies Actions And Computes Next Heads, Non-Aliasing And Branch Free So The Loop Vectorises.
+// Directions Are Up=0, Down=1, Left=2, Right=3, So Opposites Differ Only In Bit 0.
+void advanceHeads(const std::uint8_t *__restrict actions, std::uint8_t *__restrict directions,
+                  const int *__restrict headX, const int *__restrict headY,
+                  int *__restrict nextX, int *__restrict nextY, std::uint8_t *__restrict hitWall,
+                  int count, int gridSize)
+{
+    const unsigned limit = static_cast<unsigned>(gridSize);
+    for (int i = 0; i < count; ++i) {
+        int current = directions[i];
+        int wanted = actions[i] & 3;
+        int direction = (wanted ^ 1) == current ? current : wanted;
+        directions[i] = static_cast<std::uint8_t>(direction);
+
+        int x = headX[i] + (direction == 3) - (direction == 2);
+        int y = headY[i] + (direction == 1) - (direction == 0);
+        nextX[i] = x;
+        nextY[i] = y;
+        hitWall[i] = static_cast<std::uint8_t>((static_cast<unsigned>(x) >= limit) | (static_cast<unsigned>(y) >= limit));
+    }
+}
+
+}
+
+/**
+ * @brief Constructor Allocating Every Game's Storage Up Front
+ * @param envCount Number Of Games Stepped Together
+ * @param gridSize Grid Dimension Count Of Every Game, Ignored When map Is Accepted
+ * @param seed Base Seed, Game i Is Seeded With seed + i
+ * @param map Level Shared By Every Game, nullptr For The Empty Board
+ */
+BatchSnakeEnv::BatchSnakeEnv(int envCount, int gridSize, std::uint64_t seed, std::shared_ptr<const SnakeMap> map)
+    : m_map(acceptedMap(std::move(map)))
+    , m_envCount(std::max(1, envCount))
+    , m_gridSize(m_map ? m_map->gridSize() : std::clamp(gridSize, 3, MaxGridSize))
+    , m_cells(m_gridSize * m_gridSize)
+    , m_gridWords((m_cells + 63) / 64)
+    , m_episodes(0)
+    , m_headX(m_envCount)
+    , m_headY(m_envCount)
+    , m_direction(m_envCount)
+    , m_length(m_envCount)
+    , m_score(m_envCount)
+    , m_food(m_envCount)
+    , m_headSlot(m_envCount)
+    , m_freeCount(m_envCount)
+    , m_nextX(m_envCount)
+    , m_nextY(m_envCount)
+    , m_hitWall(m_envCount)
+    , m_body(static_cast<size_t>(m_envCount) * m_cells)
+    , m_occupancy(static_cast<size_t>(m_envCount) * m_gridWords)
+    , m_freeCells(static_cast<size_t>(m_envCount) * m_cells)
+    , m_freeSlot(static_cast<size_t>(m_envCount) * m_cells)
+    , m_startGrid(m_gridWords, 0)
+    , m_startFreeCells(m_cells)
+    , m_startFreeSlot(m_cells)
+    , m_spawn{m_gridSize / 2, m_gridSize / 2}
+    , m_spawnDirection(SnakeDirection::Right)
+{
+    // Start Layout Of SnakeEngine::reset(): Grid Centre Or Map Spawn, Body Trailing Behind The Head
+    if (m_map) {
+        m_startGrid = m_map->walls();
+        m_spawn = m_map->spawn();
+        m_spawnDirection = m_map->spawnDirection();
+    }
+    SnakeCell delta = directionDelta(m_spawnDirection);
+    for (int i = 0; i < SnakeMap::SpawnLength; ++i) {
+        int index = (m_spawn.y - delta.y * i) * m_gridSize + m_spawn.x - delta.x * i;
+        m_startGrid[index >> 6] |= std::uint64_t(1) << (index & 63);
+    }
+    m_startFreeCount = SnakeFreeCells::build(m_startGrid.data(), m_cells, m_startFreeCells.data(), m_startFreeSlot.data());
+
+    m_rng.resize(m_envCount);
+    for (int env = 0; env < m_envCount; ++env) {
+        resetEnv(env, seed + static_cast<std::uint64_t>(env));
+    }
+}
+
+/**
+ * @brief Restarts Every Game
+ */
+void BatchSnakeEnv::reset()
+{
+    for (int env = 0; env < m_envCount; ++env) {
+        resetEnv(env, m_rng[env].next());
+    }
+}
+
+/**
+ * @brief Starts One Game From The Precomputed Start Layout
+ */
+void BatchSnakeEnv::resetEnv(int env, std::uint64_t seed)
+{
+    m_rng[env].reseed(seed);
+
+    std::copy(m_startGrid.begin(), m_startGrid.end(), grid(env));
+    std::copy(m_startFreeCells.begin(), m_startFreeCells.begin() + m_startFreeCount, freeCells(env));
+    std::copy(m_startFreeSlot.begin(), m_startFreeSlot.end(), freeSlot(env));
+    m_freeCount[env] = m_startFreeCount;
+
+    SnakeCell delta = directionDelta(m_spawnDirection);
+    int *cells = body(env);
+    for (int i = 0; i < SnakeMap::SpawnLength; ++i) {
+        cells[i] = (m_spawn.y - delta.y * i) * m_gridSize + m_spawn.x - delta.x * i;
+    }
+
+    m_headX[env] = m_spawn.x;
+    m_headY[env] = m_spawn.y;
+    m_direction[env] = static_cast<std::uint8_t>(m_spawnDirection);
+    m_length[env] = SnakeMap::SpawnLength;
+    m_score[env] = 0;
+    m_headSlot[env] = 0;
+    spawnFood(env);
+}
+
+/**
+ * @brief Advances Every Game By One Tick
+ */
+void BatchSnakeEnv::step(const std::uint8_t *actions, float *rewards, std::uint8_t *dones)
+{
+    stepRange(0, m_envCount, actions, rewards, dones);
+}
+
+/**
+ * @brief Advances Games In [begin, end) By One Tick
+ * @param actions Requested Direction Per Game, Indexed From 0 Like The Other Arrays
+ * @param rewards Optional Reward Output Per Game
+ * @param dones Optional Episode-End Flag Per Game
+ */
+void BatchSnakeEnv::stepRange(int begin, int end, const std::uint8_t *actions, float *rewards, std::uint8_t *dones)
+{
+    // Pass 1: Direction And New Head For Every Game
+    advanceHeads(actions + begin, m_direction.data() + begin, m_headX.data() + begin, m_headY.data() + begin,
+                 m_nextX.data() + begin, m_nextY.data() + begin, m_hitWall.data() + begin,
+                 end - begin, m_gridSize);
+
+    // Pass 2: Tail, Self Collision, Food - Per Game Since Each Touches Its Own Grid
+    for (int env = begin; env < end; ++env) {
+        float reward = StepReward;
+        bool done = m_hitWall[env];
+
+        if (!done) {
+            std::uint64_t *bits = grid(env);
+            int *cells = body(env);
+            int headIndex = m_nextY[env] * m_gridSize + m_nextX[env];
+            bool ate = headIndex == m_food[env];
+
+            // Tail Moves Away Unless Food Is Eaten, So Its Cell Is Free For The Head
+            if (!ate) {
+                int tailSlot = m_headSlot[env] + m_length[env] - 1;
+                if (tailSlot >= m_cells) tailSlot -= m_cells;
+                int tail = cells[tailSlot];
+                bits[tail >> 6] &= ~(std::uint64_t(1) << (tail & 63));
+                SnakeFreeCells::release(freeCells(env), freeSlot(env), m_freeCount[env], tail);
+                --m_length[env];
+            }
+
+            // Body And Walls Share The Bitmap, So One Test Covers Both
+            if ((bits[headIndex >> 6] >> (headIndex & 63)) & 1u) {
+                done = true;
+            }
+            else {
+                bits[headIndex >> 6] |= std::uint64_t(1) << (headIndex & 63);
+                SnakeFreeCells::take(freeCells(env), freeSlot(env), m_freeCount[env], headIndex);
+                int headSlot = m_headSlot[env] - 1;
+                if (headSlot < 0) headSlot += m_cells;
+                cells[headSlot] = headIndex;
+                m_headSlot[env] = headSlot;
+                ++m_length[env];
+                m_headX[env] = m_nextX[env];
+                m_headY[env] = m_nextY[env];
+
+                if (ate) {
+                    ++m_score[env];
+                    reward = FoodReward;
+                    // A Full Grid Ends The Episode As A Win
+                    done = !spawnFood(env);
+                }
+            }
+        }
+
+        if (done) {
+            if (reward != FoodReward) reward = DeathReward;
+            ++m_episodes;
+            resetEnv(env, m_rng[env].next());
+        }
+        if (rewards) rewards[env] = reward;
+        if (dones) dones[env] = done;
+    }
+}
+
+/**
+ * @brief Chooses A Uniformly Random Free Cell For One Game, As SnakeEngine::spawnFood() Does
+ */
+bool BatchSnakeEnv::spawnFood(int env)
+{
+    m_food[env] = SnakeFreeCells::pick(freeCells(env), m_freeCount[env], m_rng[env]);
+    return m_food[env] >= 0;
+}
+
+/**
+ * @brief Writes Blocked, Head And Food Planes For Games In [begin, end)
+ * @param out Destination Of (end - begin) * observationSize() Floats
+ */
+void BatchSnakeEnv::writeObservations(float *out, int begin, int end) const
+{
+    for (int env = begin; env < end; ++env) {
+        float *bodyPlane = out + static_cast<size_t>(env - begin) * observationSize();
+        float *headPlane = bodyPlane + m_cells;
+        float *foodPlane = headPlane + m_cells;
+
+        const std::uint64_t *bits = grid(env);
+        for (int index = 0; index < m_cells; ++index) {
+            bodyPlane[index] = static_cast<float>((bits[index >> 6] >> (index & 63)) & 1u);
+        }
+        std::fill(headPlane, headPlane + 2 * m_cells, 0.0f);
+        headPlane[m_headY[env] * m_gridSize + m_headX[env]] = 1.0f;
+        if (m_food[env] >= 0) foodPlane[m_food[env]] = 1.0f;
+    }
+}
@@ -0,0 +1,133 @@
+#ifndef SNAKEBATCHENV_H
+#define SNAKEBATCHENV_H
+
+// Standard Library Only - Built Into Training And Benchmark Tools, Not The Widget
+#include "snakemap.h"
+#include "snakerandom.h"
+#include "snaketypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Thousands Of Independent Snake Games Stepped In Lockstep For Agent Training
+//
+// Plays exactly the games SnakeEngine plays (reversal ignored, the tail
+// vacates before the self check, walls and the body both kill, eating grows
+// by one, filling the grid wins, food placed through SnakeFreeCells) but
+// stores every game in structure-of-arrays form: one array per field indexed
+// by environment, bodies as ring buffers of cell indices in one flat array
+// and occupancy as one bit per cell. step() first computes every new head in
+// a branch-free pass over the arrays, then resolves collisions per game.
+// `snakebench --batch` checks the two step for step and fails on divergence.
+//
+// Finished games reset automatically inside step() with a seed drawn from
+// their own random stream, as SnakeEngine::reset() does, so the observation
+// after a done flag already belongs to the next episode.
+class BatchSnakeEnv
+{
+public:
+    // Reward Per Transition
+    static constexpr float FoodReward = 1.0f;
+    static constexpr float DeathReward = -1.0f;
+    static constexpr float StepReward = 0.0f;
+
+    // Observation Planes Per Environment: Blocked (Body And Walls), Head, Food
+    static constexpr int ObservationChannels = 3;
+
+    // Largest Grid: Every Game Keeps A Free Cell Index Of 16 Bit Cell Indices
+    // (SnakeEngine Keeps One Too At These Sizes, So Food Lands On The Same Cells)
+    static constexpr int MaxGridSize = 256;
+
+    // Create envCount Games On gridSize x gridSize, Game i Seeded With seed + i Like SnakeEngine(gridSize, seed + i).
+    // A Valid map Of At Most MaxGridSize Replaces gridSize And Adds Its Walls And Spawn. Any Other map Is
+    // Refused As SnakeEngine::setMap() Refuses Invalid Ones: The Games Use The Empty Board And map() Is Null
+    BatchSnakeEnv(int envCount, int gridSize, std::uint64_t seed, std::shared_ptr<const SnakeMap> map = nullptr);
+
+    // Restart Every Game, Each Reseeded From Its Own Stream Like SnakeEngine::reset()
+    void reset();
+
+    // Advance Every Game By One Tick. actions[i] Is A SnakeDirection Value,
+    // rewards And dones Receive One Entry Per Game (Either May Be Null)
+    void step(const std::uint8_t *actions, float *rewards, std::uint8_t *dones);
+
+    // Advance Games [begin, end) Only, So Callers Can Split A Batch Across Threads
+    void stepRange(int begin, int end, const std::uint8_t *actions, float *rewards, std::uint8_t *dones);
+
+    // Floats Per Game In writeObservations(): Channels x Grid x Grid
+    int observationSize() const { return ObservationChannels * m_cells; }
+
+    // Write A [env][channel][y][x] Tensor Of 0/1 Values For Games [begin, end)
+    void writeObservations(float *out) const { writeObservations(out, 0, m_envCount); }
+    void writeObservations(float *out, int begin, int end) const;
+
+    // Per-Game State Accessors
+    int envCount() const { return m_envCount; }
+    int gridSize() const { return m_gridSize; }
+    const SnakeMap *map() const { return m_map.get(); }
+    int length(int env) const { return m_length[env]; }
+    int score(int env) const { return m_score[env]; }
+    SnakeCell head(int env) const { return SnakeCell{m_headX[env], m_headY[env]}; }
+    SnakeCell food(int env) const { return SnakeCell{m_food[env] % m_gridSize, m_food[env] / m_gridSize}; }
+    SnakeDirection direction(int env) const { return static_cast<SnakeDirection>(m_direction[env]); }
+    bool isOccupied(int env, SnakeCell cell) const
+    {
+        int index = cell.y * m_gridSize + cell.x;
+        return (grid(env)[index >> 6] >> (index & 63)) & 1u;
+    }
+
+    // Episodes Finished Since Construction, Across All Games
+    std::uint64_t episodeCount() const { return m_episodes; }
+
+private:
+    // Start A New Episode For One Game With Its Food Stream Reseeded From seed
+    void resetEnv(int env, std::uint64_t seed);
+
+    // Place Food On A Uniformly Random Free Cell, Returns false When The Grid Is Full
+    bool spawnFood(int env);
+
+    std::uint64_t *grid(int env) { return &m_occupancy[static_cast<std::size_t>(env) * m_gridWords]; }
+    const std::uint64_t *grid(int env) const { return &m_occupancy[static_cast<std::size_t>(env) * m_gridWords]; }
+    int *body(int env) { return &m_body[static_cast<std::size_t>(env) * m_cells]; }
+    std::uint16_t *freeCells(int env) { return &m_freeCells[static_cast<std::size_t>(env) * m_cells]; }
+    std::uint16_t *freeSlot(int env) { return &m_freeSlot[static_cast<std::size_t>(env) * m_cells]; }
+
+    std::shared_ptr<const SnakeMap> m_map;  // Walls And Spawn Shared By Every Game, Null On The Empty Board
+    int m_envCount;
+    int m_gridSize;
+    int m_cells;                        // gridSize * gridSize
+    int m_gridWords;                    // 64 Bit Words Per Occupancy Grid
+    std::uint64_t m_episodes;
+
+    // One Entry Per Game
+    std::vector<int> m_headX;
+    std::vector<int> m_headY;
+    std::vector<std::uint8_t> m_direction;
+    std::vector<int> m_length;
+    std::vector<int> m_score;
+    std::vector<int> m_food;            // Cell Index Of The Food, -1 When The Grid Is Full
+    std::vector<int> m_headSlot;        // Ring Position Of The Head In The Game's Body Slice
+    std::vector<int> m_freeCount;       // Free Cells Listed In The Game's m_freeCells Slice
+    std::vector<SnakeRandom> m_rng;
+
+    // Scratch Filled By The Vectorisable Pass Of stepRange()
+    std::vector<int> m_nextX;
+    std::vector<int> m_nextY;
+    std::vector<std::uint8_t> m_hitWall;
+
+    // One Slice Per Game
+    std::vector<int> m_body;            // Ring Buffer Of Cell Indices, Capacity m_cells
+    std::vector<std::uint64_t> m_occupancy;  // Body And Walls
+    std::vector<std::uint16_t> m_freeCells;  // SnakeFreeCells Index, Capacity m_cells
+    std::vector<std::uint16_t> m_freeSlot;
+
+    // Every Episode Starts From The Same Layout, So Its Grid And Free Cell Index Are Built Once And Copied
+    std::vector<std::uint64_t> m_startGrid;
+    std::vector<std::uint16_t> m_startFreeCells;
+    std::vector<std::uint16_t> m_startFreeSlot;
+    int m_startFreeCount;
+    SnakeCell m_spawn;
+    SnakeDirection m_spawnDirection;
+};
+
+#endif // SNAKEBATCHENV_H
@@ -0,0 +1,43 @@
+#ifndef SNAKEBITS_H
+#define SNAKEBITS_H
+
+#include <cstdint>
+
+// Bit Helpers For The Packed Occupancy Grids
+namespace SnakeBits {
+
+// Number Of Set Bits In word
+inline int popCount(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    for (; word; word &= word - 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// Index Of The rank-th Set Bit Of word (rank Counted From 0, Must Be < popCount(word))
+inline int selectBit(std::uint64_t word, int rank)
+{
+    for (int i = 0; i < rank; ++i) {
+        word &= word - 1;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+    while (!(word & 1u)) {
+        word >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+}
+
+#endif // SNAKEBITS_H
@@ -0,0 +1,126 @@
+#ifndef SNAKEBODY_H
+#define SNAKEBODY_H
+
+#include "snaketypes.h"
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+// Fixed Capacity Circular Buffer Holding Snake Segments, Head First
+//
+// Moving the snake is a pushFront() of the new head and a popBack() of the
+// old tail; both only adjust an index, so a tick never shifts segments.
+// Storage starts small and doubles up to the grid's cell count as the snake
+// grows, so a short snake on a huge arena does not reserve the whole grid.
+class SnakeBody
+{
+public:
+    // Forward Iterator Walking Segments From Head To Tail
+    class ConstIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SnakeCell;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const SnakeCell *;
+        using reference = const SnakeCell &;
+
+        ConstIterator(const SnakeBody *body, int index) : m_body(body), m_index(index) {}
+
+        reference operator*() const { return (*m_body)[m_index]; }
+        pointer operator->() const { return &(*m_body)[m_index]; }
+        ConstIterator &operator++() { ++m_index; return *this; }
+        ConstIterator operator++(int) { ConstIterator copy = *this; ++m_index; return copy; }
+        bool operator==(const ConstIterator &other) const { return m_index == other.m_index; }
+        bool operator!=(const ConstIterator &other) const { return m_index != other.m_index; }
+
+    private:
+        const SnakeBody *m_body;
+        int m_index;
+    };
+
+    // Empty The Buffer And Set The Maximum Possible Snake Length
+    void reset(int maxSize)
+    {
+        m_maxSize = maxSize;
+        int initial = maxSize < InitialCapacity ? maxSize : InitialCapacity;
+        if (capacity() < initial || capacity() > maxSize) {
+            m_cells.assign(initial, SnakeCell{0, 0});
+        }
+        m_head = 0;
+        m_size = 0;
+    }
+
+    // Remove All Segments Without Releasing Storage
+    void clear() { m_head = 0; m_size = 0; }
+
+    int size() const { return m_size; }
+    int capacity() const { return static_cast<int>(m_cells.size()); }
+    bool isEmpty() const { return m_size == 0; }
+
+    // Add A New Head Segment - Caller Guarantees size() < maxSize
+    void pushFront(SnakeCell cell)
+    {
+        if (m_size == capacity()) grow();
+        m_head = (m_head == 0 ? capacity() : m_head) - 1;
+        m_cells[m_head] = cell;
+        ++m_size;
+    }
+
+    // Append A Segment Behind The Tail - Used When Laying Out A Body
+    void pushBack(SnakeCell cell)
+    {
+        if (m_size == capacity()) grow();
+        m_cells[physicalIndex(m_size)] = cell;
+        ++m_size;
+    }
+
+    // Drop The Tail Segment
+    void popBack() { --m_size; }
+
+    // Drop The Head Segment - Used To Undo pushFront()
+    void popFront()
+    {
+        m_head = m_head + 1 == capacity() ? 0 : m_head + 1;
+        --m_size;
+    }
+
+    const SnakeCell &front() const { return m_cells[m_head]; }
+    const SnakeCell &back() const { return m_cells[physicalIndex(m_size - 1)]; }
+
+    // Segment By Position, 0 Is The Head
+    const SnakeCell &operator[](int index) const { return m_cells[physicalIndex(index)]; }
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, m_size); }
+
+private:
+    // Segments Stored Before The First Growth
+    static constexpr int InitialCapacity = 1024;
+
+    // Double Storage (Capped At m_maxSize), Unwrapping The Ring So The Head Lands In Slot 0
+    void grow()
+    {
+        int newCapacity = capacity() * 2 < m_maxSize ? capacity() * 2 : m_maxSize;
+        std::vector<SnakeCell> cells(newCapacity);
+        for (int i = 0; i < m_size; ++i) {
+            cells[i] = m_cells[physicalIndex(i)];
+        }
+        m_cells.swap(cells);
+        m_head = 0;
+    }
+
+    // Map Logical Segment Position To Storage Slot Without A Division
+    int physicalIndex(int index) const
+    {
+        int slot = m_head + index;
+        return slot >= capacity() ? slot - capacity() : slot;
+    }
+
+    std::vector<SnakeCell> m_cells;     // Backing Storage, Grows With The Snake
+    int m_maxSize = 0;                  // Cell Count Of The Grid, Upper Bound For Storage
+    int m_head = 0;                     // Storage Slot Of The Head Segment
+    int m_size = 0;                     // Number Of Live Segments
+};
+
+#endif // SNAKEBODY_H
@@ -0,0 +1,372 @@
+#include "snakeengine.h"
+#include "snakebits.h"
+#include <algorithm>
+
+/**
+ * @brief Constructor For The Headless Snake Engine
+ * @param gridSize Grid Dimension Count
+ * @param seed Seed For The Food Placement Random Source
+ */
+SnakeEngine::SnakeEngine(int gridSize, std::uint64_t seed)
+    : m_gridSize(gridSize)
+    , m_freeCount(0)
+    , m_useFreeList(true)
+    , m_previousTail{0, 0}
+    , m_food{-1, -1}
+    , m_hasFood(false)
+    , m_direction(SnakeDirection::Right)
+    , m_score(0)
+    , m_gameOver(false)
+    , m_won(false)
+    , m_tickCount(0)
+    , m_changedCount(0)
+    , m_seed(seed)
+    , m_rng(seed)
+    , m_journaling(false)
+{
+    reset(gridSize, seed);
+}
+
+/**
+ * @brief Starts A New Game On The Current Grid
+ */
+void SnakeEngine::reset()
+{
+    reset(m_gridSize);
+}
+
+/**
+ * @brief Starts A New Game Seeded From The Previous Game's Random Stream
+ * @param gridSize Grid Dimension Count
+ */
+void SnakeEngine::reset(int gridSize)
+{
+    reset(gridSize, m_rng.next());
+}
+
+/**
+ * @brief Starts A New Game With A Three Segment Snake In The Grid Centre, Or At The Map's Spawn
+ * @param gridSize Grid Dimension Count
+ * @param seed Seed Determining Every Food Placement Of The Game
+ */
+void SnakeEngine::reset(int gridSize, std::uint64_t seed)
+{
+    m_seed = seed;
+    m_rng.reseed(seed);
+    discardCheckpoints();
+    m_gridSize = std::clamp(gridSize, 3, MaxGridSize);
+    if (m_map && m_map->gridSize() != m_gridSize) m_map.reset();
+
+    SnakeCell head{m_gridSize / 2, m_gridSize / 2};
+    m_direction = SnakeDirection::Right;
+    if (m_map) {
+        head = m_map->spawn();
+        m_direction = m_map->spawnDirection();
+    }
+    SnakeCell delta = directionDelta(m_direction);
+
+    m_body.reset(m_gridSize * m_gridSize);
+    for (int i = 0; i < SnakeMap::SpawnLength; ++i) {
+        m_body.pushBack(SnakeCell{head.x - delta.x * i, head.y - delta.y * i});
+    }
+    m_previousTail = m_body.back();
+    m_changedCount = 0;
+    rebuildOccupancy();
+
+    m_score = 0;
+    m_gameOver = false;
+    m_won = false;
+    m_tickCount = 0;
+
+    if (!spawnFood()) {
+        m_gameOver = true;
+        m_won = true;
+    }
+}
+
+/**
+ * @brief Switches To A Level Map, Or Back To The Empty Board
+ * @param map Level To Play, Must Be isValid(); nullptr Clears The Walls
+ */
+void SnakeEngine::setMap(std::shared_ptr<const SnakeMap> map)
+{
+    m_map = map && map->isValid() ? std::move(map) : nullptr;
+    reset(m_map ? m_map->gridSize() : m_gridSize);
+}
+
+/**
+ * @brief Starts A Game From An Explicit Body Layout On The Current Grid
+ * @param body Snake Segments, Head First, Each Adjacent To The Next
+ * @param direction Direction The Head Is Moving In
+ * @return false If The Layout Is Empty, Leaves The Grid Or Overlaps Itself
+ */
+bool SnakeEngine::loadBody(const std::vector<SnakeCell> &body, SnakeDirection direction)
+{
+    if (body.empty() || body.size() > static_cast<size_t>(m_gridSize) * m_gridSize) return false;
+    discardCheckpoints();
+
+    m_body.reset(m_gridSize * m_gridSize);
+    m_occupancy.assign((static_cast<size_t>(m_gridSize) * m_gridSize + 63) / 64, 0);
+    for (const SnakeCell &cell : body) {
+        if (!inBounds(cell) || isOccupied(cellIndex(cell)) || isWall(cell)) {
+            reset();
+            return false;
+        }
+        setOccupied(cellIndex(cell));
+        m_body.pushBack(cell);
+    }
+    m_previousTail = m_body.back();
+    m_changedCount = 0;
+    rebuildOccupancy();
+
+    m_direction = direction;
+    m_score = 0;
+    m_gameOver = false;
+    m_won = false;
+    m_tickCount = 0;
+
+    if (!spawnFood()) {
+        m_gameOver = true;
+        m_won = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Advances The Game By One Tick
+ * @param direction Requested Direction, Ignored When It Would Reverse The Snake
+ * @return Outcome Of The Tick
+ */
+SnakeStepResult SnakeEngine::step(SnakeDirection direction)
+{
+    m_changedCount = 0;
+    if (m_gameOver) return SnakeStepResult::Finished;
+
+    UndoRecord *record = nullptr;
+    if (m_journaling) {
+        m_journal.push_back(UndoRecord{m_tickCount, m_previousTail, m_food, SnakeCell{0, 0},
+                                       m_score, -1, m_direction, m_hasFood, m_gameOver, m_won, false, false});
+        record = &m_journal.back();
+    }
+
+    ++m_tickCount;
+
+    // Update Direction If Valid (Prevent Reversing)
+    if (direction != oppositeDirection(m_direction)) {
+        m_direction = direction;
+    }
+
+    SnakeCell delta = directionDelta(m_direction);
+    SnakeCell newHead{m_body.front().x + delta.x, m_body.front().y + delta.y};
+
+    // Check Wall Collision
+    if (!inBounds(newHead)) {
+        m_gameOver = true;
+        return SnakeStepResult::HitWall;
+    }
+
+    // Tail Moves Away Unless Food Is Eaten, So Its Cell Is Free For The Head
+    bool ate = m_hasFood && newHead == m_food;
+    m_previousTail = m_body.back();
+    if (!ate) {
+        if (record) {
+            record->releasedTail = m_body.back();
+            record->releasedTailCell = true;
+        }
+        releaseCell(cellIndex(m_body.back()));
+        markChanged(m_body.back());
+        m_body.popBack();
+    }
+
+    // Check Self Collision Against The Occupancy Bitmap
+    int headIndex = cellIndex(newHead);
+    if (isOccupied(headIndex)) {
+        m_gameOver = true;
+        return SnakeStepResult::HitSelf;
+    }
+
+    if (record) record->occupiedSlot = m_useFreeList ? m_freeSlot[headIndex] : 0;
+    occupyCell(headIndex);
+    markChanged(m_body.front());
+    markChanged(newHead);
+    m_body.pushFront(newHead);
+
+    if (!ate) return SnakeStepResult::Moved;
+
+    ++m_score;
+    if (record) {
+        m_rngJournal.push_back(m_rng);
+        record->spawnedFood = true;
+    }
+    if (!spawnFood()) {
+        m_gameOver = true;
+        m_won = true;
+        return SnakeStepResult::Won;
+    }
+    markChanged(m_food);
+    return SnakeStepResult::Ate;
+}
+
+/**
+ * @brief Marks The Current State So restore() Can Return To It
+ */
+SnakeEngine::Checkpoint SnakeEngine::save()
+{
+    m_journaling = true;
+    return Checkpoint{m_journal.size()};
+}
+
+/**
+ * @brief Undoes Every Tick Played Since checkpoint, Newest First
+ */
+void SnakeEngine::restore(Checkpoint checkpoint)
+{
+    while (m_journal.size() > checkpoint.journalSize) {
+        undo(m_journal.back());
+        m_journal.pop_back();
+    }
+    m_changedCount = 0;
+}
+
+/**
+ * @brief Drops All Checkpoints And Stops Journaling
+ */
+void SnakeEngine::discardCheckpoints()
+{
+    m_journal.clear();
+    m_rngJournal.clear();
+    m_journaling = false;
+}
+
+/**
+ * @brief Reverts The Body, Occupancy, Free Set And Scalars Changed By One Tick
+ *
+ * Mirrors step() in reverse: the new head is returned to the exact free set
+ * slot it came from (so later food picks match), then the tail is re-added.
+ */
+void SnakeEngine::undo(const UndoRecord &record)
+{
+    if (record.occupiedSlot >= 0) {
+        int headIndex = cellIndex(m_body.front());
+        m_body.popFront();
+        clearOccupied(headIndex);
+
+        if (m_useFreeList) {
+            int slot = record.occupiedSlot;
+            if (slot == m_freeCount) {
+                m_freeCells[m_freeCount++] = headIndex;
+            }
+            else {
+                int moved = m_freeCells[slot];
+                m_freeSlot[moved] = m_freeCount;
+                m_freeCells[m_freeCount++] = moved;
+                m_freeCells[slot] = headIndex;
+            }
+            m_freeSlot[headIndex] = slot;
+        }
+    }
+
+    if (record.releasedTailCell) {
+        int tailIndex = cellIndex(record.releasedTail);
+        if (m_useFreeList) {
+            --m_freeCount;
+            m_freeSlot[tailIndex] = -1;
+        }
+        setOccupied(tailIndex);
+        m_body.pushBack(record.releasedTail);
+    }
+
+    if (record.spawnedFood) {
+        m_rng = m_rngJournal.back();
+        m_rngJournal.pop_back();
+    }
+    m_tickCount = record.tickCount;
+    m_previousTail = record.previousTail;
+    m_food = record.food;
+    m_score = record.score;
+    m_direction = record.direction;
+    m_hasFood = record.hasFood;
+    m_gameOver = record.gameOver;
+    m_won = record.won;
+}
+
+/**
+ * @brief Rebuilds The Occupancy Bitmap And Free Cell Set From The Current Body
+ */
+void SnakeEngine::rebuildOccupancy()
+{
+    int cells = m_gridSize * m_gridSize;
+    if (m_map) {
+        m_occupancy = m_map->walls();
+    } else {
+        m_occupancy.assign((static_cast<size_t>(cells) + 63) / 64, 0);
+    }
+    for (const SnakeCell &cell : m_body) {
+        setOccupied(cellIndex(cell));
+    }
+
+    // Huge Arenas Release The Free Cell Index Instead Of Spending Eight Bytes Per Cell On It
+    m_useFreeList = cells <= FreeListCellLimit;
+    m_freeCount = 0;
+    if (!m_useFreeList) {
+        std::vector<int>().swap(m_freeCells);
+        std::vector<int>().swap(m_freeSlot);
+        return;
+    }
+    m_freeCells.resize(cells);
+    m_freeSlot.resize(cells);
+    m_freeCount = SnakeFreeCells::build(m_occupancy.data(), cells, m_freeCells.data(), m_freeSlot.data());
+}
+
+/**
+ * @brief Spawns Food On A Uniformly Chosen Free Cell, O(1) With The Free Cell Index
+ * @return false Only When The Snake Fills The Entire Grid (Win Condition)
+ */
+bool SnakeEngine::spawnFood()
+{
+    m_hasFood = false;
+    int index = -1;
+    if (m_useFreeList) {
+        index = SnakeFreeCells::pick(m_freeCells.data(), m_freeCount, m_rng);
+    }
+    else {
+        index = sampleFreeCell();
+    }
+    if (index < 0) return false;
+    m_food = SnakeCell{index % m_gridSize, index / m_gridSize};
+    m_hasFood = true;
+    return true;
+}
+
+/**
+ * @brief Picks A Uniformly Random Free Cell Straight From The Occupancy Bitmap
+ *
+ * On a large arena the snake covers a tiny fraction of the grid, so a few
+ * random probes almost always land on a free cell. Should they all miss, a
+ * rank over the free cells is drawn and found with popcounts in one pass.
+ * @return Cell Index, Or -1 When No Cell Is Free
+ */
+int SnakeEngine::sampleFreeCell()
+{
+    const int cells = m_gridSize * m_gridSize;
+    const int freeCells = cells - m_body.size() - (m_map ? m_map->wallCount() : 0);
+    if (freeCells <= 0) return -1;
+
+    for (int probe = 0; probe < 16; ++probe) {
+        int index = static_cast<int>(m_rng.bounded(static_cast<std::uint32_t>(cells)));
+        if (!isOccupied(index)) return index;
+    }
+
+    int rank = static_cast<int>(m_rng.bounded(static_cast<std::uint32_t>(freeCells)));
+    const int words = static_cast<int>(m_occupancy.size());
+    for (int word = 0; word < words; ++word) {
+        std::uint64_t freeBits = ~m_occupancy[word];
+        int valid = std::min(64, cells - word * 64);
+        if (valid < 64) freeBits &= (std::uint64_t(1) << valid) - 1;
+
+        int count = SnakeBits::popCount(freeBits);
+        if (rank < count) return word * 64 + SnakeBits::selectBit(freeBits, rank);
+        rank -= count;
+    }
+    return -1;
+}
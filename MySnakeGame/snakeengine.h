@@ -0,0 +1,179 @@
+#ifndef SNAKEENGINE_H
+#define SNAKEENGINE_H
+
+// Standard Library Only - The Engine Must Build Without Qt Widgets Or An Event Loop
+#include "snakebody.h"
+#include "snakefreecells.h"
+#include "snakemap.h"
+#include "snakerandom.h"
+#include "snaketypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Headless Snake Game Rules - The Snake Widget Only Renders This State
+class SnakeEngine
+{
+public:
+    // Largest Supported Grid Dimension (Large Arena Mode)
+    static constexpr int MaxGridSize = 4096;
+
+    // Grids With More Cells Than This Skip The O(Cells) Free Cell Index And Place Food
+    // By Sampling The Occupancy Bitmap, Keeping Memory At About One Bit Per Cell
+    static constexpr int FreeListCellLimit = 1 << 20;
+
+    // Construct Engine With Grid Dimension And Random Seed
+    explicit SnakeEngine(int gridSize = 20, std::uint64_t seed = std::random_device{}());
+
+    // Start A New Game, Optionally On A Different Grid Size; The Game Seed Is Drawn From The Previous Game
+    void reset();
+    void reset(int gridSize);
+
+    // Start A New Game Whose Food Sequence Is Fully Determined By seed (Used By Replays)
+    void reset(int gridSize, std::uint64_t seed);
+
+    // Play On A Level With Walls (nullptr Returns To The Empty Board) And Start A New Game On It.
+    // The Map Stays Until A reset() Asks For A Different Grid Size
+    void setMap(std::shared_ptr<const SnakeMap> map);
+    const SnakeMap *map() const { return m_map.get(); }
+
+    // Start A Game From An Explicit Body Layout (Head First), Used By Tools And Benchmarks
+    bool loadBody(const std::vector<SnakeCell> &body, SnakeDirection direction);
+
+    // Advance The Game By One Tick Using The Requested Direction
+    SnakeStepResult step(SnakeDirection direction);
+
+    // Lookahead Support: save() Marks The Current State And Starts Journaling Every
+    // Tick; restore() Undoes The Ticks Since A Checkpoint In O(Ticks Undone).
+    // Restoring Invalidates Later Checkpoints; reset(), loadBody() And
+    // discardCheckpoints() Invalidate All Of Them And Stop Journaling.
+    struct Checkpoint
+    {
+        std::size_t journalSize;
+    };
+    Checkpoint save();
+    void restore(Checkpoint checkpoint);
+    void discardCheckpoints();
+
+    // Replace The Food Random Stream Without Restarting, So A Search Cannot See Real Future Food.
+    // Not Journaled: restore() Keeps The Reseeded Stream Unless A Food Spawn Is Undone
+    void reseedFood(std::uint64_t seed) { m_rng.reseed(seed); }
+
+    // Check Whether A Cell Is Outside The Grid, A Wall Or Covered By The Snake - O(1)
+    bool isBlocked(SnakeCell cell) const
+    {
+        return !inBounds(cell) || isOccupied(cellIndex(cell));
+    }
+
+    // Check Whether An In-Grid Cell Is A Map Wall
+    bool isWall(SnakeCell cell) const { return m_map && m_map->isWall(cell); }
+
+    // Game State Accessors
+    int gridSize() const { return m_gridSize; }
+    int length() const { return m_body.size(); }
+    SnakeCell head() const { return m_body.front(); }
+    SnakeCell tail() const { return m_body.back(); }
+    SnakeCell previousTail() const { return m_previousTail; }
+    SnakeCell segment(int index) const { return m_body[index]; }
+    const SnakeBody &body() const { return m_body; }
+
+    // Cells Whose Contents Changed During The Last Tick (Head, Previous Head, Vacated Tail, New Food)
+    int changedCellCount() const { return m_changedCount; }
+    SnakeCell changedCell(int index) const { return m_changed[index]; }
+    SnakeCell food() const { return m_food; }
+    bool hasFood() const { return m_hasFood; }
+    SnakeDirection direction() const { return m_direction; }
+    int score() const { return m_score; }
+    bool isGameOver() const { return m_gameOver; }
+    bool hasWon() const { return m_won; }
+    std::uint64_t tickCount() const { return m_tickCount; }
+
+    // Seed Of The Current Game, Enough To Reproduce It Together With The Inputs
+    std::uint64_t seed() const { return m_seed; }
+
+private:
+    // Place Food On A Uniformly Random Free Cell, Returns false When The Grid Is Full
+    bool spawnFood();
+
+    // Check Whether A Cell Lies Inside The Grid
+    bool inBounds(SnakeCell cell) const
+    {
+        return cell.x >= 0 && cell.x < m_gridSize && cell.y >= 0 && cell.y < m_gridSize;
+    }
+
+    // Occupancy Bitmap Helpers, One Bit Per Cell In Row-Major Order
+    int cellIndex(SnakeCell cell) const { return cell.y * m_gridSize + cell.x; }
+    bool isOccupied(int index) const { return (m_occupancy[index >> 6] >> (index & 63)) & 1u; }
+    void setOccupied(int index) { m_occupancy[index >> 6] |= std::uint64_t(1) << (index & 63); }
+    void clearOccupied(int index) { m_occupancy[index >> 6] &= ~(std::uint64_t(1) << (index & 63)); }
+
+    // Move A Cell Between The Free Set And The Occupied Bitmap
+    void occupyCell(int index)
+    {
+        setOccupied(index);
+        if (m_useFreeList) SnakeFreeCells::take(m_freeCells.data(), m_freeSlot.data(), m_freeCount, index);
+    }
+    void releaseCell(int index)
+    {
+        clearOccupied(index);
+        if (m_useFreeList) SnakeFreeCells::release(m_freeCells.data(), m_freeSlot.data(), m_freeCount, index);
+    }
+
+    // Size The Bitmap And Free Set For The Grid And Mark Every Wall And Body Segment
+    void rebuildOccupancy();
+
+    // Large Grid Food Placement: Random Probes, Then A Ranked Pick Over The Free Bits
+    int sampleFreeCell();
+
+    // Record A Cell As Changed This Tick
+    void markChanged(SnakeCell cell) { m_changed[m_changedCount++] = cell; }
+
+    // Everything One Tick Changes, Enough To Undo It
+    struct UndoRecord
+    {
+        std::uint64_t tickCount;
+        SnakeCell previousTail;
+        SnakeCell food;
+        SnakeCell releasedTail;         // Valid When releasedTailCell
+        int score;
+        int occupiedSlot;               // Free Set Slot The New Head Was Taken From (0 Without A
+                                        // Free List), -1 If No Head Was Pushed
+        SnakeDirection direction;
+        bool hasFood;
+        bool gameOver;
+        bool won;
+        bool releasedTailCell;
+        bool spawnedFood;               // Random State Was Pushed To m_rngJournal
+    };
+
+    // Undo The Last Journaled Tick
+    void undo(const UndoRecord &record);
+
+    int m_gridSize;                     // Grid Dimension Count
+    SnakeBody m_body;                   // Snake Segments, Head First
+    std::vector<std::uint64_t> m_occupancy; // Bitmap Of Cells Covered By The Snake Or A Wall
+    std::shared_ptr<const SnakeMap> m_map;  // Level Walls And Spawn, Null On The Empty Board
+    std::vector<int> m_freeCells;       // Free Cell Indices, Dense In [0, m_freeCount)
+    std::vector<int> m_freeSlot;        // Position Of Each Cell In m_freeCells, -1 If Occupied
+    int m_freeCount;                    // Number Of Free Cells Listed In m_freeCells
+    bool m_useFreeList;                 // Grid Is Small Enough For m_freeCells / m_freeSlot
+    SnakeCell m_previousTail;           // Tail Cell Before The Last Tick (For Interpolation)
+    SnakeCell m_food;                   // Current Food Position
+    bool m_hasFood;                     // Food Is Currently Placed On The Grid
+    SnakeDirection m_direction;         // Current Movement Direction
+    int m_score;                        // Food Eaten This Game
+    bool m_gameOver;                    // Game Over Flag
+    bool m_won;                         // Snake Filled The Grid
+    std::uint64_t m_tickCount;          // Ticks Since Reset
+    SnakeCell m_changed[4];             // Cells Changed By The Last Tick
+    int m_changedCount;                 // Number Of Valid Entries In m_changed
+    std::uint64_t m_seed;               // Seed The Current Game Started From
+    SnakeRandom m_rng;                  // Per-Engine Random Source For Food
+    bool m_journaling;                  // step() Appends To m_journal
+    std::vector<UndoRecord> m_journal;  // One Record Per Tick Since The Oldest Checkpoint
+    std::vector<SnakeRandom> m_rngJournal;  // Random State Before Each Journaled Food Spawn
+};
+
+#endif // SNAKEENGINE_H
@@ -0,0 +1,65 @@
+#ifndef SNAKEFREECELLS_H
+#define SNAKEFREECELLS_H
+
+// Standard Library Only - Shared By SnakeEngine And BatchSnakeEnv So Both Place Food Identically
+#include "snakerandom.h"
+#include <cstdint>
+
+// Free Cell Index Over Caller-Owned Arrays, The Food Placement Rule Of Every Game
+//
+// cells lists the free cell indices densely in [0, count) and slot holds
+// each cell's position there, Index(-1) while it is occupied. Taking a cell
+// moves the last entry into its place and releasing one appends it, so both
+// are O(1). Where food lands for a given random stream depends on that
+// order, which in turn depends only on the sequence of takes and releases,
+// so two games applying the same moves through these functions stay
+// identical. Index is int for the engine; the batch environment stores
+// uint16_t to halve its per-game footprint.
+namespace SnakeFreeCells {
+
+// List Every Clear Bit Of occupancy Below cellCount In Ascending Order, Returns The Count
+template <typename Index>
+int build(const std::uint64_t *occupancy, int cellCount, Index *cells, Index *slot)
+{
+    int count = 0;
+    for (int index = 0; index < cellCount; ++index) {
+        if ((occupancy[index >> 6] >> (index & 63)) & 1u) {
+            slot[index] = static_cast<Index>(-1);
+        } else {
+            slot[index] = static_cast<Index>(count);
+            cells[count++] = static_cast<Index>(index);
+        }
+    }
+    return count;
+}
+
+// Remove A Free Cell From The Index
+template <typename Index>
+void take(Index *cells, Index *slot, int &count, int index)
+{
+    Index position = slot[index];
+    Index last = cells[--count];
+    cells[position] = last;
+    slot[last] = position;
+    slot[index] = static_cast<Index>(-1);
+}
+
+// Append A Newly Freed Cell
+template <typename Index>
+void release(Index *cells, Index *slot, int &count, int index)
+{
+    slot[index] = static_cast<Index>(count);
+    cells[count++] = static_cast<Index>(index);
+}
+
+// Uniformly Random Free Cell, -1 When None Is Left
+template <typename Index>
+int pick(const Index *cells, int count, SnakeRandom &rng)
+{
+    if (count <= 0) return -1;
+    return cells[rng.bounded(static_cast<std::uint32_t>(count))];
+}
+
+}
+
+#endif // SNAKEFREECELLS_H
@@ -0,0 +1,73 @@
+#ifndef SNAKEHISTOGRAM_H
+#define SNAKEHISTOGRAM_H
+
+// Standard Library Only - Shared By The Widget And The Headless Tools
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Fixed Width Histogram Of Nanosecond Durations
+//
+// Samples land in bucketNs wide buckets starting at zero; anything past the
+// last bucket is counted in it, negative samples in the first. Storage is
+// allocated once, so recording from the frame loop never allocates.
+class SnakeHistogram
+{
+public:
+    SnakeHistogram(std::int64_t bucketNs = 250000, int bucketCount = 128)
+        : m_bucketNs(std::max<std::int64_t>(1, bucketNs))
+        , m_buckets(static_cast<std::size_t>(std::max(1, bucketCount)), 0)
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        std::fill(m_buckets.begin(), m_buckets.end(), 0);
+        m_count = 0;
+        m_sumNs = 0;
+        m_minNs = 0;
+        m_maxNs = 0;
+    }
+
+    void record(std::int64_t ns)
+    {
+        std::int64_t bucket = std::clamp<std::int64_t>(ns / m_bucketNs, 0, bucketCount() - 1);
+        ++m_buckets[static_cast<std::size_t>(bucket)];
+        m_minNs = m_count == 0 ? ns : std::min(m_minNs, ns);
+        m_maxNs = m_count == 0 ? ns : std::max(m_maxNs, ns);
+        m_sumNs += ns;
+        ++m_count;
+    }
+
+    // Upper Edge Of The Bucket Holding The Given Fraction (0-1) Of Samples
+    std::int64_t percentileNs(double fraction) const
+    {
+        if (m_count == 0) return 0;
+        std::uint64_t target = static_cast<std::uint64_t>(std::clamp(fraction, 0.0, 1.0) * (m_count - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (int i = 0; i < bucketCount(); ++i) {
+            seen += m_buckets[static_cast<std::size_t>(i)];
+            if (seen >= target) return i == bucketCount() - 1 ? m_maxNs : std::min(m_maxNs, (i + 1) * m_bucketNs);
+        }
+        return m_maxNs;
+    }
+
+    std::uint64_t count() const { return m_count; }
+    std::int64_t minNs() const { return m_minNs; }
+    std::int64_t maxNs() const { return m_maxNs; }
+    std::int64_t meanNs() const { return m_count ? m_sumNs / static_cast<std::int64_t>(m_count) : 0; }
+    std::int64_t bucketNs() const { return m_bucketNs; }
+    int bucketCount() const { return static_cast<int>(m_buckets.size()); }
+    std::uint64_t bucket(int index) const { return m_buckets[static_cast<std::size_t>(index)]; }
+
+private:
+    std::int64_t m_bucketNs;
+    std::vector<std::uint64_t> m_buckets;
+    std::uint64_t m_count;
+    std::int64_t m_sumNs;
+    std::int64_t m_minNs;
+    std::int64_t m_maxNs;
+};
+
+#endif // SNAKEHISTOGRAM_H
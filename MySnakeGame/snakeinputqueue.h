@@ -0,0 +1,57 @@
+#ifndef SNAKEINPUTQUEUE_H
+#define SNAKEINPUTQUEUE_H
+
+#include "snaketypes.h"
+#include <cstdint>
+
+// One Turn Requested By The Player And When The Key Arrived
+struct SnakeInput
+{
+    SnakeDirection direction;
+    std::int64_t timestampNs;           // Monotonic Clock Reading When The Key Was Received
+};
+
+// Bounded FIFO Of Pending Turns, Consumed One Per Tick
+//
+// Two presses inside one tick (Up then Left to turn a corner) both survive
+// instead of the second overwriting the first. Each request is validated
+// against the direction the snake will have once everything already queued
+// has been applied, so a reversal or a repeat of the last queued turn is
+// rejected on entry rather than wasting a tick.
+class SnakeInputQueue
+{
+public:
+    // Turns Buffered At Most; Further Presses Are Ignored Until A Tick Frees A Slot
+    static constexpr int Capacity = 3;
+
+    void clear() { m_head = m_count = 0; }
+    bool isEmpty() const { return m_count == 0; }
+    int count() const { return m_count; }
+
+    // Queue A Turn, current Is The Snake's Direction Now. Returns false When Rejected
+    bool push(SnakeDirection direction, std::int64_t timestampNs, SnakeDirection current)
+    {
+        SnakeDirection last = m_count ? m_entries[(m_head + m_count - 1) % Capacity].direction : current;
+        if (m_count == Capacity || direction == last || direction == oppositeDirection(last)) return false;
+
+        m_entries[(m_head + m_count) % Capacity] = SnakeInput{direction, timestampNs};
+        ++m_count;
+        return true;
+    }
+
+    // Remove And Return The Oldest Turn; The Queue Must Not Be Empty
+    SnakeInput pop()
+    {
+        SnakeInput input = m_entries[m_head];
+        m_head = (m_head + 1) % Capacity;
+        --m_count;
+        return input;
+    }
+
+private:
+    SnakeInput m_entries[Capacity] = {};
+    int m_head = 0;
+    int m_count = 0;
+};
+
+#endif // SNAKEINPUTQUEUE_H
@@ -0,0 +1,255 @@
+#include "snakemap.h"
+#include "snakebits.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace {
+
+const std::uint8_t Magic[4] = { 'S', 'N', 'K', 'M' };
+const std::uint8_t FormatVersion = 1;
+
+// Largest Grid A Map May Declare, Matching SnakeEngine::MaxGridSize
+const int MaxGridSize = 4096;
+
+void writeVarint(std::vector<std::uint8_t> &out, std::uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+bool readVarint(const std::uint8_t *data, std::size_t size, std::size_t &offset, std::uint64_t &value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64 && offset < size; shift += 7) {
+        std::uint8_t byte = data[offset++];
+        value |= std::uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+}
+
+/**
+ * @brief Constructor For An Open Map
+ * @param gridSize Grid Dimension Count
+ */
+SnakeMap::SnakeMap(int gridSize)
+    : m_gridSize(std::clamp(gridSize, 3, MaxGridSize))
+    , m_walls((static_cast<std::size_t>(m_gridSize) * m_gridSize + 63) / 64, 0)
+    , m_spawn{m_gridSize / 2, m_gridSize / 2}
+{
+}
+
+/**
+ * @brief Adds Or Removes A Wall, Keeping The Wall Count Current
+ */
+void SnakeMap::setWall(SnakeCell cell, bool wall)
+{
+    if (cell.x < 0 || cell.x >= m_gridSize || cell.y < 0 || cell.y >= m_gridSize) return;
+    if (isWall(cell) == wall) return;
+
+    int index = cell.y * m_gridSize + cell.x;
+    m_walls[index >> 6] ^= std::uint64_t(1) << (index & 63);
+    m_wallCount += wall ? 1 : -1;
+}
+
+/**
+ * @brief Sets Where The Head Starts; The Body Trails Behind It
+ */
+void SnakeMap::setSpawn(SnakeCell head, SnakeDirection direction)
+{
+    m_spawn = head;
+    m_spawnDirection = direction;
+}
+
+/**
+ * @brief Checks The Spawn Body And The First Cell Ahead Are Free Grid Cells
+ */
+bool SnakeMap::isValid() const
+{
+    if (m_gridSize < 3) return false;
+
+    SnakeCell delta = directionDelta(m_spawnDirection);
+    for (int i = -1; i < SpawnLength; ++i) {
+        SnakeCell cell{m_spawn.x - delta.x * i, m_spawn.y - delta.y * i};
+        if (cell.x < 0 || cell.x >= m_gridSize || cell.y < 0 || cell.y >= m_gridSize || isWall(cell)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 64 Bit FNV-1a Over The Serialized Layout
+ */
+std::uint64_t SnakeMap::hash() const
+{
+    std::uint64_t hash = 1469598103934665603ull;
+    for (std::uint8_t byte : serialize()) {
+        hash = (hash ^ byte) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Encodes The Map As Header, Spawn And Alternating Free / Wall Run Lengths
+ */
+std::vector<std::uint8_t> SnakeMap::serialize() const
+{
+    std::vector<std::uint8_t> out(Magic, Magic + 4);
+    out.push_back(FormatVersion);
+    writeVarint(out, static_cast<std::uint64_t>(m_gridSize));
+    writeVarint(out, static_cast<std::uint64_t>(m_spawn.x));
+    writeVarint(out, static_cast<std::uint64_t>(m_spawn.y));
+    writeVarint(out, static_cast<std::uint64_t>(m_spawnDirection));
+
+    // Runs Start With Free Cells (Possibly An Empty Run) And Alternate; Whole Words Are Skipped
+    const int cells = m_gridSize * m_gridSize;
+    std::vector<std::uint8_t> runs;
+    std::uint64_t runCount = 0;
+    bool wall = false;
+    int runStart = 0;
+    int index = 0;
+    while (index < cells) {
+        std::uint64_t word = m_walls[index >> 6] >> (index & 63);
+        if (!wall) word = ~word;
+        int valid = std::min(64 - (index & 63), cells - index);
+        if (valid < 64) word &= (std::uint64_t(1) << valid) - 1;
+
+        // Trailing Ones Are The Cells Continuing The Current Run
+        int same = SnakeBits::popCount(word & ~(word + 1));
+        index += same;
+        if (same < valid) {
+            writeVarint(runs, static_cast<std::uint64_t>(index - runStart));
+            ++runCount;
+            runStart = index;
+            wall = !wall;
+        }
+    }
+    writeVarint(runs, static_cast<std::uint64_t>(cells - runStart));
+    ++runCount;
+
+    writeVarint(out, runCount);
+    out.insert(out.end(), runs.begin(), runs.end());
+    return out;
+}
+
+/**
+ * @brief Decodes A Buffer Produced By serialize()
+ * @return false If The Header Is Wrong, A Field Is Out Of Range Or The Runs Do Not Cover The Grid
+ */
+bool SnakeMap::deserialize(const std::uint8_t *data, std::size_t size, SnakeMap &map)
+{
+    if (size < 5 || !std::equal(Magic, Magic + 4, data) || data[4] != FormatVersion) return false;
+
+    std::size_t offset = 5;
+    std::uint64_t fields[5];
+    for (std::uint64_t &field : fields) {
+        if (!readVarint(data, size, offset, field)) return false;
+    }
+    if (fields[0] < 3 || fields[0] > static_cast<std::uint64_t>(MaxGridSize)) return false;
+    if (fields[1] >= fields[0] || fields[2] >= fields[0] || fields[3] > 3) return false;
+
+    SnakeMap result(static_cast<int>(fields[0]));
+    const std::uint64_t cells = fields[0] * fields[0];
+    if (fields[4] > cells + 1) return false;
+
+    std::uint64_t index = 0;
+    bool wall = false;
+    for (std::uint64_t run = 0; run < fields[4]; ++run, wall = !wall) {
+        std::uint64_t length = 0;
+        if (!readVarint(data, size, offset, length) || length > cells - index) return false;
+        for (std::uint64_t end = index + length; wall && index < end; ++index) {
+            result.m_walls[index >> 6] |= std::uint64_t(1) << (index & 63);
+        }
+        if (wall) {
+            result.m_wallCount += static_cast<int>(length);
+        } else {
+            index += length;
+        }
+    }
+    if (index != cells) return false;
+
+    result.setSpawn(SnakeCell{static_cast<int>(fields[1]), static_cast<int>(fields[2])},
+                    static_cast<SnakeDirection>(fields[3]));
+    map = std::move(result);
+    return true;
+}
+
+/**
+ * @brief Reads An ASCII Drawing Of A Level
+ * @return false When The Text Is Empty, Too Large Or Has No Valid Spawn
+ */
+bool SnakeMap::fromText(const std::string &text, SnakeMap &map)
+{
+    std::vector<std::string> rows;
+    std::string row;
+    for (char c : text) {
+        if (c == '\n') {
+            rows.push_back(row);
+            row.clear();
+        } else if (c != '\r') {
+            row.push_back(c);
+        }
+    }
+    if (!row.empty()) rows.push_back(row);
+
+    int gridSize = static_cast<int>(rows.size());
+    for (const std::string &line : rows) {
+        gridSize = std::max(gridSize, static_cast<int>(line.size()));
+    }
+    if (gridSize < 3 || gridSize > MaxGridSize) return false;
+
+    SnakeMap result(gridSize);
+    bool spawned = false;
+    for (int y = 0; y < static_cast<int>(rows.size()); ++y) {
+        for (int x = 0; x < static_cast<int>(rows[y].size()); ++x) {
+            SnakeCell cell{x, y};
+            switch (rows[y][x]) {
+            case '#': result.setWall(cell, true); break;
+            case '>': result.setSpawn(cell, SnakeDirection::Right); spawned = true; break;
+            case '<': result.setSpawn(cell, SnakeDirection::Left); spawned = true; break;
+            case '^': result.setSpawn(cell, SnakeDirection::Up); spawned = true; break;
+            case 'v': result.setSpawn(cell, SnakeDirection::Down); spawned = true; break;
+            default: break;
+            }
+        }
+    }
+
+    // Without A Marker The Snake Starts Where It Would On An Empty Board
+    if (!spawned) result.setSpawn(SnakeCell{gridSize / 2, gridSize / 2}, SnakeDirection::Right);
+    if (!result.isValid()) return false;
+    map = std::move(result);
+    return true;
+}
+
+/**
+ * @brief Writes The Binary Map File
+ */
+bool SnakeMap::save(const std::string &path) const
+{
+    std::vector<std::uint8_t> bytes = serialize();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Reads A Binary Map File, Falling Back To The ASCII Layout
+ */
+bool SnakeMap::load(const std::string &path, SnakeMap &map)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (deserialize(bytes.data(), bytes.size(), map)) return map.isValid();
+    if (bytes.size() >= 4 && std::equal(Magic, Magic + 4, bytes.data())) return false;
+    return fromText(std::string(bytes.begin(), bytes.end()), map);
+}
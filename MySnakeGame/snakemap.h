@@ -0,0 +1,79 @@
+#ifndef SNAKEMAP_H
+#define SNAKEMAP_H
+
+// Standard Library Only - Maps Are Loaded By The Widget And The Headless Tools
+#include "snaketypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class SnakeMapFields;
+
+// Level Layout: Static Walls On A Square Grid Plus Where The Snake Starts
+//
+// Walls are kept as one bit per cell in the same row-major word layout as
+// the engine's occupancy bitmap, so the engine ORs them straight in. The
+// ".snkm" file ("SNKM" header) run-length encodes that bitmap as varints of
+// alternating free and wall runs, so a mostly open 1000x1000 level is a few
+// kilobytes. fromText() reads an ASCII drawing for hand-made levels.
+class SnakeMap
+{
+public:
+    // Length Of The Snake Laid Out Behind spawn(), Matching SnakeEngine::reset()
+    static constexpr int SpawnLength = 3;
+
+    SnakeMap() = default;
+
+    // Open gridSize x gridSize Map, Spawning In The Centre Heading Right Like An Empty Board
+    explicit SnakeMap(int gridSize);
+
+    // Edit The Layout
+    void setWall(SnakeCell cell, bool wall);
+    void setSpawn(SnakeCell head, SnakeDirection direction);
+
+    // The Spawn Body And The Cell Ahead Of It Are On The Grid And Free Of Walls
+    bool isValid() const;
+
+    int gridSize() const { return m_gridSize; }
+    int wallCount() const { return m_wallCount; }
+    int freeCellCount() const { return m_gridSize * m_gridSize - m_wallCount; }
+    bool isWall(SnakeCell cell) const
+    {
+        int index = cell.y * m_gridSize + cell.x;
+        return (m_walls[index >> 6] >> (index & 63)) & 1u;
+    }
+    const std::vector<std::uint64_t> &walls() const { return m_walls; }
+    SnakeCell spawn() const { return m_spawn; }
+    SnakeDirection spawnDirection() const { return m_spawnDirection; }
+
+    // FNV-1a Of serialize(), Identifies The Layout In Field Caches And Replays. O(Cells)
+    std::uint64_t hash() const;
+
+    // Precomputed Distance Fields And Cycle, Attached Before The Map Is Shared
+    void setFields(std::shared_ptr<const SnakeMapFields> fields) { m_fields = std::move(fields); }
+    const SnakeMapFields *fields() const { return m_fields.get(); }
+
+    // Binary File Image ("SNKM" Header Followed By Varints)
+    std::vector<std::uint8_t> serialize() const;
+    static bool deserialize(const std::uint8_t *data, std::size_t size, SnakeMap &map);
+
+    // ASCII Layout: '#' Wall, '.' Or ' ' Free, '>' '<' '^' 'v' The Spawn Head And Heading.
+    // The Grid Is As Large As The Longer Of Row Count And Row Length, Missing Cells Are Free
+    static bool fromText(const std::string &text, SnakeMap &map);
+
+    // File Helpers Around serialize() / deserialize()
+    bool save(const std::string &path) const;
+    static bool load(const std::string &path, SnakeMap &map);
+
+private:
+    int m_gridSize = 0;
+    int m_wallCount = 0;
+    std::vector<std::uint64_t> m_walls; // One Bit Per Cell, Row-Major
+    SnakeCell m_spawn{0, 0};
+    SnakeDirection m_spawnDirection = SnakeDirection::Right;
+    std::shared_ptr<const SnakeMapFields> m_fields;
+};
+
+#endif // SNAKEMAP_H
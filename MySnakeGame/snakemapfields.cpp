@@ -0,0 +1,362 @@
+#include "snakemapfields.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char Magic[4] = { 'S', 'N', 'K', 'F' };
+const std::uint32_t FormatVersion = 1;
+const std::uint32_t ByteOrderMark = 0x01020304u;
+
+const SnakeDirection AllDirections[] = {
+    SnakeDirection::Up, SnakeDirection::Down, SnakeDirection::Left, SnakeDirection::Right
+};
+
+/**
+ * @brief Breadth-First Distances From source To Every Free Cell, Unreachable Elsewhere
+ */
+void bfsDistances(const SnakeMap &map, int source, std::vector<std::uint32_t> &distances, std::vector<int> &queue)
+{
+    const int gridSize = map.gridSize();
+    distances.assign(static_cast<std::size_t>(gridSize) * gridSize, SnakeMapFields::Unreachable);
+    queue.clear();
+    queue.push_back(source);
+    distances[source] = 0;
+
+    for (std::size_t read = 0; read < queue.size(); ++read) {
+        int cell = queue[read];
+        SnakeCell at{cell % gridSize, cell / gridSize};
+        for (SnakeDirection direction : AllDirections) {
+            SnakeCell delta = directionDelta(direction);
+            SnakeCell next{at.x + delta.x, at.y + delta.y};
+            if (next.x < 0 || next.x >= gridSize || next.y < 0 || next.y >= gridSize || map.isWall(next)) continue;
+            int index = next.y * gridSize + next.x;
+            if (distances[index] != SnakeMapFields::Unreachable) continue;
+            distances[index] = distances[cell] + 1;
+            queue.push_back(index);
+        }
+    }
+}
+
+}
+
+/**
+ * @brief Destructor, Unmaps A Mapped Image
+ */
+SnakeMapFields::~SnakeMapFields()
+{
+#if !defined(_WIN32)
+    if (m_mapping) munmap(m_mapping, m_mappingSize);
+#endif
+}
+
+/**
+ * @brief Header Plus Landmark List, Distance Fields And Optional Cycle Arrays
+ */
+std::size_t SnakeMapFields::imageSize(std::size_t cells, int landmarks, bool cycle)
+{
+    std::size_t words = static_cast<std::size_t>(landmarks) * (cells + 1) + (cycle ? 2 * cells : 0);
+    return sizeof(Header) + words * sizeof(std::uint32_t);
+}
+
+/**
+ * @brief Computes Landmark Fields And The Block Cycle For A Map
+ *
+ * The first landmark is the cell farthest from the spawn; each further one
+ * is the cell farthest from all landmarks chosen so far, which spreads them
+ * to the map's extremities where their bounds are tightest.
+ */
+std::shared_ptr<SnakeMapFields> SnakeMapFields::build(const SnakeMap &map, int landmarks)
+{
+    const int gridSize = map.gridSize();
+    const std::size_t cells = static_cast<std::size_t>(gridSize) * gridSize;
+    const int count = std::max(1, std::min(landmarks, map.freeCellCount()));
+
+    std::vector<std::uint32_t> next(cells);
+    std::vector<std::uint32_t> order(cells);
+    std::uint32_t cycleLength = buildCycle(map, next.data(), order.data());
+
+    std::shared_ptr<SnakeMapFields> fields(new SnakeMapFields());
+    fields->m_storage.assign(imageSize(cells, count, cycleLength > 0), 0);
+    std::uint8_t *image = fields->m_storage.data();
+
+    Header header;
+    std::memcpy(header.magic, Magic, 4);
+    header.version = FormatVersion;
+    header.byteOrder = ByteOrderMark;
+    header.gridSize = static_cast<std::uint32_t>(gridSize);
+    header.mapHash = map.hash();
+    header.landmarkCount = static_cast<std::uint32_t>(count);
+    header.cycleLength = cycleLength;
+    header.size = fields->m_storage.size();
+    std::memcpy(image, &header, sizeof(Header));
+
+    std::uint32_t *landmarkCells = reinterpret_cast<std::uint32_t *>(image + sizeof(Header));
+    std::uint32_t *distances = landmarkCells + count;
+
+    // Farthest Point Landmark Selection Over The Spawn's Region
+    std::vector<std::uint32_t> field;
+    std::vector<int> queue;
+    std::vector<std::uint32_t> nearest(cells, Unreachable);
+    bfsDistances(map, map.spawn().y * gridSize + map.spawn().x, field, queue);
+    int source = queue.back();
+    for (int k = 0; k < count; ++k) {
+        landmarkCells[k] = static_cast<std::uint32_t>(source);
+        bfsDistances(map, source, field, queue);
+
+        int farthest = source;
+        std::uint32_t farthestDistance = 0;
+        for (std::size_t cell = 0; cell < cells; ++cell) {
+            distances[cell * count + k] = field[cell];
+            if (field[cell] == Unreachable) continue;
+            nearest[cell] = std::min(nearest[cell], field[cell]);
+            if (nearest[cell] > farthestDistance) {
+                farthestDistance = nearest[cell];
+                farthest = static_cast<int>(cell);
+            }
+        }
+        source = farthest;
+    }
+
+    if (cycleLength > 0) {
+        std::copy(next.begin(), next.end(), distances + cells * count);
+        std::copy(order.begin(), order.end(), distances + cells * count + cells);
+    }
+
+    fields->attach(image, fields->m_storage.size(), map, header.mapHash);
+    return fields;
+}
+
+/**
+ * @brief Hamiltonian Cycle From A Spanning Tree Of 2x2 Blocks
+ *
+ * Every free block starts as a small counter-clockwise loop. Joining two
+ * blocks along a tree edge swaps their two facing sides for two crossing
+ * edges, which splices the loops into one; after all tree edges the loop
+ * visits every free cell. Blocks are joined in breadth-first order from the
+ * spawn's block so the cycle is the same on every machine.
+ */
+std::uint32_t SnakeMapFields::buildCycle(const SnakeMap &map, std::uint32_t *next, std::uint32_t *order)
+{
+    const int gridSize = map.gridSize();
+    const std::size_t cells = static_cast<std::size_t>(gridSize) * gridSize;
+    std::fill(next, next + cells, Unreachable);
+    std::fill(order, order + cells, Unreachable);
+    if (gridSize % 2 != 0 || map.freeCellCount() < 4) return 0;
+
+    const int blocks = gridSize / 2;
+    auto cellIndex = [gridSize](int x, int y) { return y * gridSize + x; };
+
+    // Each Block Must Be Entirely Free Or Entirely Wall
+    std::vector<std::uint8_t> open(static_cast<std::size_t>(blocks) * blocks, 0);
+    int openBlocks = 0;
+    for (int by = 0; by < blocks; ++by) {
+        for (int bx = 0; bx < blocks; ++bx) {
+            int walls = 0;
+            for (int i = 0; i < 4; ++i) {
+                walls += map.isWall(SnakeCell{2 * bx + (i & 1), 2 * by + (i >> 1)}) ? 1 : 0;
+            }
+            if (walls != 0 && walls != 4) return 0;
+            if (walls == 0) {
+                open[by * blocks + bx] = 1;
+                ++openBlocks;
+            }
+        }
+    }
+
+    // Counter-Clockwise Loop Inside Every Free Block: Down, Right, Up, Left
+    for (int by = 0; by < blocks; ++by) {
+        for (int bx = 0; bx < blocks; ++bx) {
+            if (!open[by * blocks + bx]) continue;
+            int left = 2 * bx;
+            int top = 2 * by;
+            next[cellIndex(left, top)] = cellIndex(left, top + 1);
+            next[cellIndex(left, top + 1)] = cellIndex(left + 1, top + 1);
+            next[cellIndex(left + 1, top + 1)] = cellIndex(left + 1, top);
+            next[cellIndex(left + 1, top)] = cellIndex(left, top);
+        }
+    }
+
+    // Breadth-First Spanning Tree Over Free Blocks, Splicing Loops Along Each Tree Edge
+    SnakeCell spawn = map.spawn();
+    int root = (spawn.y / 2) * blocks + spawn.x / 2;
+    std::vector<std::uint8_t> joined(open.size(), 0);
+    std::vector<int> queue(1, root);
+    joined[root] = 1;
+    for (std::size_t read = 0; read < queue.size(); ++read) {
+        int block = queue[read];
+        int bx = block % blocks;
+        int by = block / blocks;
+        for (SnakeDirection direction : AllDirections) {
+            SnakeCell delta = directionDelta(direction);
+            int nx = bx + delta.x;
+            int ny = by + delta.y;
+            if (nx < 0 || nx >= blocks || ny < 0 || ny >= blocks) continue;
+            int neighbour = ny * blocks + nx;
+            if (!open[neighbour] || joined[neighbour]) continue;
+            joined[neighbour] = 1;
+            queue.push_back(neighbour);
+
+            // Name The Pair By Position, a Left Of Or Above b
+            int ax = std::min(bx, nx), ay = std::min(by, ny);
+            int cx = std::max(bx, nx), cy = std::max(by, ny);
+            if (delta.y == 0) {
+                next[cellIndex(2 * ax + 1, 2 * ay + 1)] = cellIndex(2 * cx, 2 * cy + 1);
+                next[cellIndex(2 * cx, 2 * cy)] = cellIndex(2 * ax + 1, 2 * ay);
+            } else {
+                next[cellIndex(2 * ax, 2 * ay + 1)] = cellIndex(2 * cx, 2 * cy);
+                next[cellIndex(2 * cx + 1, 2 * cy)] = cellIndex(2 * ax + 1, 2 * ay + 1);
+            }
+        }
+    }
+    if (static_cast<int>(queue.size()) != openBlocks) {
+        std::fill(next, next + cells, Unreachable);
+        return 0;
+    }
+
+    // Number The Cells Along The Cycle Starting At The Spawn
+    std::uint32_t position = 0;
+    int cell = cellIndex(spawn.x, spawn.y);
+    do {
+        order[cell] = position++;
+        cell = static_cast<int>(next[cell]);
+    } while (cell != cellIndex(spawn.x, spawn.y) && position <= cells);
+    return position;
+}
+
+/**
+ * @brief Validates A Built Or Loaded Image And Sets Up The Array Views
+ */
+bool SnakeMapFields::attach(const std::uint8_t *data, std::size_t size, const SnakeMap &map, std::uint64_t mapHash)
+{
+    if (size < sizeof(Header)) return false;
+    const Header *header = reinterpret_cast<const Header *>(data);
+    const std::size_t cells = static_cast<std::size_t>(map.gridSize()) * map.gridSize();
+    if (std::memcmp(header->magic, Magic, 4) != 0 || header->version != FormatVersion
+        || header->byteOrder != ByteOrderMark || header->gridSize != static_cast<std::uint32_t>(map.gridSize())
+        || header->mapHash != mapHash || header->size != size
+        || header->landmarkCount == 0 || header->landmarkCount > cells || header->cycleLength > cells
+        || imageSize(cells, static_cast<int>(header->landmarkCount), header->cycleLength > 0) != size) {
+        return false;
+    }
+
+    m_header = header;
+    m_landmarks = reinterpret_cast<const std::uint32_t *>(data + sizeof(Header));
+    m_distances = m_landmarks + header->landmarkCount;
+    m_cycleNext = header->cycleLength > 0 ? m_distances + cells * header->landmarkCount : nullptr;
+    m_cycleOrder = header->cycleLength > 0 ? m_cycleNext + cells : nullptr;
+    return true;
+}
+
+/**
+ * @brief Maps A Cache File Read-Only, Reading It Into Memory Where mmap Is Unavailable
+ */
+std::shared_ptr<SnakeMapFields> SnakeMapFields::open(const std::string &path, const SnakeMap &map)
+{
+    std::shared_ptr<SnakeMapFields> fields(new SnakeMapFields());
+    const std::uint8_t *data = nullptr;
+    std::size_t size = 0;
+
+#if !defined(_WIN32)
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) return nullptr;
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(Header))) {
+        ::close(descriptor);
+        return nullptr;
+    }
+    size = static_cast<std::size_t>(info.st_size);
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);
+    if (mapping == MAP_FAILED) return nullptr;
+    fields->m_mapping = mapping;
+    fields->m_mappingSize = size;
+    data = static_cast<const std::uint8_t *>(mapping);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return nullptr;
+    fields->m_storage.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data = fields->m_storage.data();
+    size = fields->m_storage.size();
+#endif
+
+    if (!fields->attach(data, size, map, map.hash())) return nullptr;
+    return fields;
+}
+
+/**
+ * @brief Writes The Image Next To path And Renames It Into Place
+ */
+bool SnakeMapFields::save(const std::string &path) const
+{
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(m_header), static_cast<std::streamsize>(m_header->size));
+        if (!file) return false;
+    }
+    std::remove(path.c_str());
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+/**
+ * @brief Cache File Name Keyed By Map Hash And Grid Size
+ */
+std::string SnakeMapFields::cacheFileName(const SnakeMap &map)
+{
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llx-%d.snkf",
+                  static_cast<unsigned long long>(map.hash()), map.gridSize());
+    return name;
+}
+
+/**
+ * @brief Uses The Cached Fields When Valid, Otherwise Builds And Caches Them
+ * @param fromCache Set To Whether The Fields Came From The Cache
+ */
+std::shared_ptr<SnakeMapFields> SnakeMapFields::loadOrBuild(const std::string &directory, const SnakeMap &map,
+                                                            bool *fromCache)
+{
+    std::string path = directory + "/" + cacheFileName(map);
+    std::shared_ptr<SnakeMapFields> fields = open(path, map);
+    if (fromCache) *fromCache = fields != nullptr;
+    if (fields) return fields;
+
+    fields = build(map);
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    fields->save(path);
+    return fields;
+}
+
+/**
+ * @brief Largest Landmark Difference, Never Below The Manhattan Distance
+ */
+int SnakeMapFields::lowerBound(int from, int to) const
+{
+    const int gridSize = this->gridSize();
+    int bound = std::abs(from % gridSize - to % gridSize) + std::abs(from / gridSize - to / gridSize);
+
+    const std::uint32_t count = m_header->landmarkCount;
+    const std::uint32_t *a = m_distances + static_cast<std::size_t>(from) * count;
+    const std::uint32_t *b = m_distances + static_cast<std::size_t>(to) * count;
+    for (std::uint32_t k = 0; k < count; ++k) {
+        if ((a[k] == Unreachable) != (b[k] == Unreachable)) return -1;
+        if (a[k] == Unreachable) continue;
+        int difference = static_cast<int>(a[k] > b[k] ? a[k] - b[k] : b[k] - a[k]);
+        bound = std::max(bound, difference);
+    }
+    return bound;
+}
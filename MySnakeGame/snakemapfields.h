@@ -0,0 +1,114 @@
+#ifndef SNAKEMAPFIELDS_H
+#define SNAKEMAPFIELDS_H
+
+// Standard Library Only (Plus POSIX mmap Where Available)
+#include "snakemap.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Precomputed Search Data For One SnakeMap, Cached On Disk
+//
+// Landmarks: BFS distance fields from a few landmark cells spread over the
+// map (each picked farthest from those before it). By the triangle
+// inequality |d(L, a) - d(L, b)| never exceeds the true wall-aware distance
+// from a to b, so the largest difference over all landmarks is a lower bound
+// that sees around walls where the Manhattan distance does not. Distances
+// are stored cell-major, so one lookup touches one cache line.
+//
+// Cycle: a Hamiltonian cycle over every free cell, built from a spanning
+// tree of the 2x2 blocks of the map. It exists when the grid is even and
+// every aligned 2x2 block is either all wall or all free and the free
+// blocks are connected; otherwise hasCycle() is false.
+//
+// The ".snkf" file is the in-memory image itself: a fixed header followed by
+// the arrays, so open() memory-maps it and is ready once the header checks
+// out, paging fields in as they are read. Files are named after the map hash
+// and grid size and are rebuilt when either changes.
+class SnakeMapFields
+{
+public:
+    static constexpr int DefaultLandmarks = 8;
+    static constexpr std::uint32_t Unreachable = 0xFFFFFFFFu;
+
+    ~SnakeMapFields();
+    SnakeMapFields(const SnakeMapFields &) = delete;
+    SnakeMapFields &operator=(const SnakeMapFields &) = delete;
+
+    // Compute Fields And Cycle For map In Memory
+    static std::shared_ptr<SnakeMapFields> build(const SnakeMap &map, int landmarks = DefaultLandmarks);
+
+    // Memory-Map A Cache File, nullptr When It Is Missing, Damaged Or Made For Another Map
+    static std::shared_ptr<SnakeMapFields> open(const std::string &path, const SnakeMap &map);
+
+    // Write The Image Atomically (Temporary File, Then Rename)
+    bool save(const std::string &path) const;
+
+    // "<map hash>-<grid size>.snkf"
+    static std::string cacheFileName(const SnakeMap &map);
+
+    // open() The Cached File In directory, Else build() And save() It There
+    static std::shared_ptr<SnakeMapFields> loadOrBuild(const std::string &directory, const SnakeMap &map,
+                                                       bool *fromCache = nullptr);
+
+    int gridSize() const { return static_cast<int>(m_header->gridSize); }
+    std::uint64_t mapHash() const { return m_header->mapHash; }
+    bool isMapped() const { return m_mapping != nullptr; }
+
+    // Landmark Distance Fields
+    int landmarkCount() const { return static_cast<int>(m_header->landmarkCount); }
+    int landmark(int index) const { return static_cast<int>(m_landmarks[index]); }
+    std::uint32_t distance(int landmark, int cell) const
+    {
+        return m_distances[static_cast<std::size_t>(cell) * m_header->landmarkCount + landmark];
+    }
+
+    // Lower Bound On The Path Length From from To to Around Walls, -1 When No Path Exists
+    int lowerBound(int from, int to) const;
+
+    // Hamiltonian Cycle Over The Free Cells
+    bool hasCycle() const { return m_header->cycleLength > 0; }
+    int cycleLength() const { return static_cast<int>(m_header->cycleLength); }
+    int cycleNext(int cell) const { return static_cast<int>(m_cycleNext[cell]); }
+    int cycleOrder(int cell) const { return static_cast<int>(m_cycleOrder[cell]); }
+
+private:
+    // File Header, Followed By landmarkCount Cells, cells * landmarkCount Distances And, With
+    // A Cycle, cells Next Cells And cells Cycle Positions (All 32 Bit)
+    struct Header
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t byteOrder;        // Written As 0x01020304, Rejects Files From Other Endianness
+        std::uint32_t gridSize;
+        std::uint64_t mapHash;
+        std::uint32_t landmarkCount;
+        std::uint32_t cycleLength;      // Free Cells On The Cycle, 0 Without One
+        std::uint64_t size;             // Total Bytes Including The Header
+    };
+
+    SnakeMapFields() = default;
+
+    // Point The Accessors Into data After Checking The Header Against map, false If It Does Not Fit
+    bool attach(const std::uint8_t *data, std::size_t size, const SnakeMap &map, std::uint64_t mapHash);
+
+    // Bytes Of An Image With The Given Shape
+    static std::size_t imageSize(std::size_t cells, int landmarks, bool cycle);
+
+    // Fill The Cycle Arrays, Returns The Cycle Length Or 0 When The Map Has No Block Cycle
+    static std::uint32_t buildCycle(const SnakeMap &map, std::uint32_t *next, std::uint32_t *order);
+
+    std::vector<std::uint8_t> m_storage;    // Built Or Read Image When Not Mapped
+    void *m_mapping = nullptr;              // Memory-Mapped Image
+    std::size_t m_mappingSize = 0;
+
+    const Header *m_header = nullptr;
+    const std::uint32_t *m_landmarks = nullptr;
+    const std::uint32_t *m_distances = nullptr;
+    const std::uint32_t *m_cycleNext = nullptr;
+    const std::uint32_t *m_cycleOrder = nullptr;
+};
+
+#endif // SNAKEMAPFIELDS_H
@@ -0,0 +1,184 @@
+#include "snakemcts.h"
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+const SnakeDirection AllDirections[] = {
+    SnakeDirection::Up, SnakeDirection::Down, SnakeDirection::Left, SnakeDirection::Right
+};
+
+// Value Lost When A Simulated Line Of Play Ends In A Collision
+const float DeathPenalty = 2.0f;
+
+// UCT Exploration Constant
+const float Exploration = 1.4f;
+
+// Chance A Rollout Step Heads For The Food Instead Of Moving Randomly
+const std::uint32_t GreedyPercent = 70;
+
+}
+
+/**
+ * @brief Constructor
+ * @param threadCount Search Threads, 0 Uses Every Hardware Thread
+ * @param iterationsPerThread Tree Iterations Each Thread Runs Per Decision
+ * @param rolloutDepth Maximum Rollout Ticks, 0 Picks Twice The Grid Size
+ */
+MctsStrategy::MctsStrategy(int threadCount, int iterationsPerThread, int rolloutDepth)
+    : m_pool(threadCount)
+    , m_iterations(iterationsPerThread > 0 ? iterationsPerThread : 1)
+    , m_rolloutDepth(rolloutDepth)
+    , m_workers(m_pool.threadCount())
+    , m_rollouts(0)
+{
+}
+
+/**
+ * @brief Searches In Parallel And Returns The Most Visited Root Move
+ */
+SnakeDirection MctsStrategy::decide(const SnakeEngine &engine)
+{
+    std::uint64_t seed = engine.seed() ^ (engine.tickCount() * 0x9E3779B97F4A7C15ull);
+    m_pool.run(static_cast<int>(m_workers.size()), [&](int index, int) {
+        search(m_workers[index], engine, seed + static_cast<std::uint64_t>(index));
+    });
+
+    int visits[4] = {};
+    m_rollouts = 0;
+    for (const Worker &worker : m_workers) {
+        m_rollouts += worker.rollouts;
+        const Node &root = worker.nodes.front();
+        for (int i = 0; i < root.childCount; ++i) {
+            const Node &child = worker.nodes[root.firstChild + i];
+            visits[static_cast<int>(child.move)] += child.visits;
+        }
+    }
+
+    SnakeDirection best = engine.direction();
+    int bestVisits = 0;
+    for (SnakeDirection direction : AllDirections) {
+        if (visits[static_cast<int>(direction)] > bestVisits) {
+            bestVisits = visits[static_cast<int>(direction)];
+            best = direction;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Builds A Fresh Tree On The Worker's Engine Copy
+ *
+ * The copy is made once per decision; every iteration afterwards rewinds it
+ * with restore(), which undoes only the ticks that iteration played.
+ */
+void MctsStrategy::search(Worker &worker, const SnakeEngine &engine, std::uint64_t seed)
+{
+    SnakeEngine &state = worker.engine;
+    state = engine;
+    worker.rng.reseed(seed);
+    SnakeEngine::Checkpoint root = state.save();
+    const int rootScore = engine.score();
+
+    worker.nodes.clear();
+    worker.nodes.push_back(Node{-1, 0, 0, 0.0f, engine.direction()});
+
+    for (int iteration = 0; iteration < m_iterations; ++iteration) {
+        state.restore(root);
+        state.reseedFood(worker.rng.next());
+
+        worker.path.assign(1, 0);
+        int current = 0;
+
+        // Selection And Expansion
+        while (!state.isGameOver()) {
+            if (worker.nodes[current].firstChild < 0) {
+                int first = static_cast<int>(worker.nodes.size());
+                SnakeDirection reverse = oppositeDirection(state.direction());
+                for (SnakeDirection direction : AllDirections) {
+                    if (direction == reverse) continue;
+                    worker.nodes.push_back(Node{-1, 0, 0, 0.0f, direction});
+                }
+                worker.nodes[current].firstChild = first;
+                worker.nodes[current].childCount = static_cast<int>(worker.nodes.size()) - first;
+            }
+
+            const Node &node = worker.nodes[current];
+            int chosen = -1;
+            float bestScore = -1e30f;
+            float logVisits = std::log(static_cast<float>(node.visits + 1));
+            for (int i = 0; i < node.childCount; ++i) {
+                const Node &child = worker.nodes[node.firstChild + i];
+                float score = child.visits == 0
+                    ? 1e30f - static_cast<float>(worker.rng.bounded(1024))
+                    : child.totalValue / child.visits + Exploration * std::sqrt(logVisits / child.visits);
+                if (score > bestScore) {
+                    bestScore = score;
+                    chosen = node.firstChild + i;
+                }
+            }
+
+            bool newLeaf = worker.nodes[chosen].visits == 0;
+            state.step(worker.nodes[chosen].move);
+            worker.path.push_back(chosen);
+            current = chosen;
+            if (newLeaf) break;
+        }
+
+        // Simulation From The New Leaf, Then Backpropagation
+        rollout(worker);
+        float value = static_cast<float>(state.score() - rootScore);
+        if (state.isGameOver() && !state.hasWon()) value -= DeathPenalty;
+
+        for (int index : worker.path) {
+            ++worker.nodes[index].visits;
+            worker.nodes[index].totalValue += value;
+        }
+    }
+
+    state.discardCheckpoints();
+}
+
+/**
+ * @brief Plays Out The Worker's Engine With A Food-Seeking Random Policy
+ */
+void MctsStrategy::rollout(Worker &worker)
+{
+    SnakeEngine &state = worker.engine;
+    int depth = m_rolloutDepth > 0 ? m_rolloutDepth : 2 * state.gridSize();
+    ++worker.rollouts;
+
+    for (int tick = 0; tick < depth && !state.isGameOver(); ++tick) {
+        SnakeCell head = state.head();
+        SnakeCell food = state.food();
+        SnakeDirection reverse = oppositeDirection(state.direction());
+
+        SnakeDirection safe[3];
+        int safeCount = 0;
+        SnakeDirection closest = state.direction();
+        int closestDistance = -1;
+        for (SnakeDirection direction : AllDirections) {
+            if (direction == reverse) continue;
+            SnakeCell delta = directionDelta(direction);
+            SnakeCell next{head.x + delta.x, head.y + delta.y};
+            if (state.isBlocked(next)) continue;
+
+            safe[safeCount++] = direction;
+            int distance = std::abs(next.x - food.x) + std::abs(next.y - food.y);
+            if (closestDistance < 0 || distance < closestDistance) {
+                closestDistance = distance;
+                closest = direction;
+            }
+        }
+
+        if (safeCount == 0) {
+            state.step(state.direction());
+        }
+        else if (worker.rng.bounded(100) < GreedyPercent) {
+            state.step(closest);
+        }
+        else {
+            state.step(safe[worker.rng.bounded(static_cast<std::uint32_t>(safeCount))]);
+        }
+    }
+}
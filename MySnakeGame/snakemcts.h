@@ -0,0 +1,62 @@
+#ifndef SNAKEMCTS_H
+#define SNAKEMCTS_H
+
+#include "snakeautopilot.h"
+#include "snakethreadpool.h"
+#include <cstdint>
+#include <vector>
+
+// Monte Carlo Tree Search Autopilot
+//
+// Root parallel: every worker searches its own tree on its own copy of the
+// engine, then root visit counts are summed and the most visited move wins.
+// Each iteration rewinds the copy with SnakeEngine::restore(), which costs
+// only the ticks the iteration played, and reseeds the food stream so the
+// search plans against random food rather than the real upcoming placements.
+class MctsStrategy : public SnakeStrategy
+{
+public:
+    // threadCount 0 Uses Every Hardware Thread
+    explicit MctsStrategy(int threadCount = 0, int iterationsPerThread = 256, int rolloutDepth = 0);
+
+    const char *name() const override { return "mcts"; }
+    SnakeDirection decide(const SnakeEngine &engine) override;
+
+    // Rollouts Played By All Workers Since Construction
+    std::uint64_t rolloutCount() const { return m_rollouts; }
+
+private:
+    // Search Tree Node, Children Stored Contiguously In The Worker's Arena
+    struct Node
+    {
+        int firstChild;                 // -1 Until Expanded
+        int childCount;
+        int visits;
+        float totalValue;
+        SnakeDirection move;            // Move Leading Into This Node
+    };
+
+    // Per-Thread Search State, Reused Across Decisions
+    struct Worker
+    {
+        SnakeEngine engine;
+        std::vector<Node> nodes;
+        std::vector<int> path;
+        SnakeRandom rng;
+        std::uint64_t rollouts = 0;
+    };
+
+    // Run iterations On One Worker From A Fresh Tree Rooted At engine
+    void search(Worker &worker, const SnakeEngine &engine, std::uint64_t seed);
+
+    // Play Out The Worker's Engine With A Cheap Food-Seeking Random Policy
+    void rollout(Worker &worker);
+
+    SnakeThreadPool m_pool;
+    int m_iterations;
+    int m_rolloutDepth;
+    std::vector<Worker> m_workers;
+    std::uint64_t m_rollouts;
+};
+
+#endif // SNAKEMCTS_H
@@ -0,0 +1,130 @@
+#include "snakeparticles.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Downward Acceleration Applied To Every Particle (Pixels Per Second Squared)
+const float Gravity = 180.0f;
+
+// Lifetime Of A Freshly Spawned Particle In Seconds
+const float ParticleLife = 1.2f;
+
+// values[i] += rates[i] * dt, Non-Aliasing So The Loop Vectorises Without Runtime Checks
+void integrate(float *__restrict values, const float *__restrict rates, int count, float dt)
+{
+    for (int i = 0; i < count; ++i) {
+        values[i] += rates[i] * dt;
+    }
+}
+
+}
+
+/**
+ * @brief Constructor Allocating All Particle Storage Up Front
+ * @param capacity Maximum Number Of Live Particles
+ */
+ParticlePool::ParticlePool(int capacity)
+    : m_x(capacity)
+    , m_y(capacity)
+    , m_vx(capacity)
+    , m_vy(capacity)
+    , m_life(capacity)
+    , m_count(0)
+    , m_seed(0x9E3779B9u)
+{
+}
+
+/**
+ * @brief Emits Particles Flying Outward From A Point
+ * @param x Burst Centre X
+ * @param y Burst Centre Y
+ * @param count Number Of Particles Requested
+ * @param speed Initial Speed In Pixels Per Second
+ */
+void ParticlePool::spawnBurst(float x, float y, int count, float speed)
+{
+    int spawn = std::min(count, capacity() - m_count);
+    for (int i = 0; i < spawn; ++i) {
+        float angle = nextRandom() * 6.2831853f;
+        float scale = 0.5f + 0.5f * nextRandom();
+        int slot = m_count + i;
+        m_x[slot] = x;
+        m_y[slot] = y;
+        m_vx[slot] = std::cos(angle) * speed * scale;
+        m_vy[slot] = std::sin(angle) * speed * scale;
+        m_life[slot] = ParticleLife;
+    }
+    m_count += spawn;
+}
+
+/**
+ * @brief Advances All Live Particles
+ * @param dt Frame Time In Seconds
+ * @param floorY Particles Below This Line Are Expired
+ */
+void ParticlePool::update(float dt, float floorY)
+{
+    if (m_count == 0) return;
+
+    float *x = m_x.data();
+    float *y = m_y.data();
+    float *vx = m_vx.data();
+    float *vy = m_vy.data();
+    float *life = m_life.data();
+    const int count = m_count;
+
+    // Branch-Free Integration Passes Over Contiguous Arrays
+    for (int i = 0; i < count; ++i) {
+        vy[i] += Gravity * dt;
+    }
+    integrate(x, vx, count, dt);
+    integrate(y, vy, count, dt);
+    for (int i = 0; i < count; ++i) {
+        life[i] -= dt;
+    }
+
+    // Compact Survivors To The Front, Preserving Order
+    int alive = 0;
+    for (int i = 0; i < count; ++i) {
+        if (life[i] > 0.0f && y[i] <= floorY) {
+            x[alive] = x[i];
+            y[alive] = y[i];
+            vx[alive] = vx[i];
+            vy[alive] = vy[i];
+            life[alive] = life[i];
+            ++alive;
+        }
+    }
+    m_count = alive;
+}
+
+/**
+ * @brief Bounding Box Of Live Particle Centres
+ * @return false If No Particle Is Alive
+ */
+bool ParticlePool::bounds(float &left, float &top, float &right, float &bottom) const
+{
+    if (m_count == 0) return false;
+
+    left = right = m_x[0];
+    top = bottom = m_y[0];
+    for (int i = 1; i < m_count; ++i) {
+        left = std::min(left, m_x[i]);
+        right = std::max(right, m_x[i]);
+        top = std::min(top, m_y[i]);
+        bottom = std::max(bottom, m_y[i]);
+    }
+    return true;
+}
+
+/**
+ * @brief Xorshift Step Mapped To [0, 1)
+ */
+float ParticlePool::nextRandom()
+{
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    return (m_seed >> 8) * (1.0f / 16777216.0f);
+}
@@ -0,0 +1,49 @@
+#ifndef SNAKEPARTICLES_H
+#define SNAKEPARTICLES_H
+
+#include <cstdint>
+#include <vector>
+
+// Fixed Capacity Particle Pool In Structure-Of-Arrays Layout
+//
+// Each attribute lives in its own contiguous float array so the per-frame
+// integration is a set of straight loops the compiler can vectorise. Storage
+// is allocated once; spawning and expiring particles never allocate.
+class ParticlePool
+{
+public:
+    // Allocate Storage For Up To capacity Live Particles
+    explicit ParticlePool(int capacity = 256);
+
+    // Drop Every Live Particle
+    void clear() { m_count = 0; }
+
+    // Emit A Radial Burst Around A Point, Extra Particles Are Discarded When Full
+    void spawnBurst(float x, float y, int count, float speed);
+
+    // Integrate Motion By dt Seconds And Expire Dead Or Off-Screen Particles
+    void update(float dt, float floorY);
+
+    // Compute Bounding Box Of Live Particles, Returns false When Empty
+    bool bounds(float &left, float &top, float &right, float &bottom) const;
+
+    int count() const { return m_count; }
+    int capacity() const { return static_cast<int>(m_x.size()); }
+    float x(int index) const { return m_x[index]; }
+    float y(int index) const { return m_y[index]; }
+    float life(int index) const { return m_life[index]; }
+
+private:
+    // Cheap Per-Pool Random Source For Burst Directions
+    float nextRandom();
+
+    std::vector<float> m_x;             // Horizontal Positions
+    std::vector<float> m_y;             // Vertical Positions
+    std::vector<float> m_vx;            // Horizontal Velocities (Pixels Per Second)
+    std::vector<float> m_vy;            // Vertical Velocities (Pixels Per Second)
+    std::vector<float> m_life;          // Remaining Life In Seconds
+    int m_count;                        // Live Particles, Packed At The Front
+    std::uint32_t m_seed;               // State Of The Burst Random Source
+};
+
+#endif // SNAKEPARTICLES_H
@@ -0,0 +1,65 @@
+#ifndef SNAKERANDOM_H
+#define SNAKERANDOM_H
+
+#include <cstdint>
+
+// Seedable xoshiro256** Generator
+//
+// The output sequence depends only on the seed - unlike std distributions it
+// is identical across compilers and standard libraries, which replays rely on.
+class SnakeRandom
+{
+public:
+    // Seed Through SplitMix64 So Nearby Seeds Give Unrelated Streams
+    explicit SnakeRandom(std::uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(std::uint64_t seed)
+    {
+        for (std::uint64_t &word : m_state) {
+            seed += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    // Next Raw 64 Bit Output
+    std::uint64_t next()
+    {
+        std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        std::uint64_t t = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+        return result;
+    }
+
+    // Uniform Integer In [0, bound) Using Lemire's Multiply-Shift With Rejection
+    std::uint32_t bounded(std::uint32_t bound)
+    {
+        std::uint64_t product = (next() >> 32) * bound;
+        std::uint32_t low = static_cast<std::uint32_t>(product);
+        if (low < bound) {
+            std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                product = (next() >> 32) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+private:
+    static std::uint64_t rotl(std::uint64_t value, int shift)
+    {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+    std::uint64_t m_state[4];
+};
+
+#endif // SNAKERANDOM_H
@@ -0,0 +1,355 @@
+#include "snakerenderer.h"
+#include <QFont>
+#include <QPen>
+#include <QVector>
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Body Sprite Variant Of A Grid Cell
+ *
+ * Chosen by position rather than by segment so both drawing modes agree:
+ * viewport scanning only knows which cells are occupied, not by which
+ * segment, and the colours must not jump when a snake crosses between modes.
+ */
+int bodyVariant(SnakeCell cell)
+{
+    return (cell.x * 7 + cell.y * 13) % SnakeSpriteAtlas::BodyVariants;
+}
+
+}
+
+/**
+ * @brief Draws A Complete Frame
+ * @param painter Target Painter, Logical Coordinates Matching state.size
+ * @param engine Game State To Draw
+ * @param state Presentation State (Camera, Tweens, Animations, HUD)
+ * @param dirty Region Being Repainted, Empty For A Full Frame
+ */
+void SnakeRenderer::render(QPainter &painter, const SnakeEngine &engine, const SnakeRenderState &state,
+                           const QRegion &dirty)
+{
+    const int cellSize = state.cellSize;
+    const int gridSize = engine.gridSize();
+    bool fullRepaint = dirty.isEmpty() || dirty.boundingRect().contains(QRect(QPoint(0, 0), state.size));
+
+    // Refresh Static Layer After Resize, Difficulty, Cell Size Or Screen (DPR) Changes
+    LayerKey key{state.size, state.devicePixelRatio, cellSize, gridSize, state.difficulty, state.arena,
+                 state.arena ? nullptr : engine.map()};
+    if (!(key == m_layerKey)) {
+        rebuildStaticLayer(key);
+    }
+
+    // Blit Cached Background And Grid, Then Draw Only The Dynamic Layer
+    QPoint origin = state.arena ? state.camera.toPoint() : QPoint();
+    if (state.arena && cellSize > 0) {
+        painter.drawImage(-(origin.x() % cellSize), -(origin.y() % cellSize), m_staticLayer);
+    } else {
+        painter.drawImage(0, 0, m_staticLayer);
+    }
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+    // Rebuild Sprites When Cell Size Or Screen (DPR) Changed
+    if (!m_sprites.matches(cellSize, state.devicePixelRatio)) {
+        m_sprites.rebuild(cellSize, state.devicePixelRatio);
+    }
+
+    // World Is Drawn In Grid Pixels Shifted By The Camera
+    painter.save();
+    painter.translate(-origin);
+    QRect visible = visibleCells(state, gridSize);
+
+    // Arena Walls Scroll, So They Are Drawn Per Visible Cell Instead Of Cached
+    if (state.arena && engine.map()) {
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(wallColor());
+        for (int y = visible.top(); y <= visible.bottom(); ++y) {
+            for (int x = visible.left(); x <= visible.right(); ++x) {
+                if (engine.isWall(SnakeCell{x, y})) painter.drawRect(x * cellSize, y * cellSize, cellSize, cellSize);
+            }
+        }
+    }
+
+    // Draw Food
+    SnakeCell food = engine.food();
+    if (engine.hasFood() && gridSize > 0) {
+        m_sprites.drawFood(painter, QPointF(food.x * cellSize, food.y * cellSize));
+    }
+
+    // Draw Particle Effects
+    if (state.particles) {
+        int particleSize = qBound(2, cellSize / 8, 4);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(QColor(255, 255, 255, 100));
+        for (int i = 0; i < state.particles->count(); ++i) {
+            painter.drawEllipse(QPointF(state.particles->x(i), state.particles->y(i)), particleSize, particleSize);
+        }
+    }
+
+    // Ghost Goes Underneath, Through The Same Sprites With Only A Constant Opacity Added
+    if (state.ghost && state.ghost->gridSize() == gridSize && state.ghost->length() > 0) {
+        painter.setOpacity(state.ghostOpacity);
+        drawSnake(painter, *state.ghost, state, visible, dirty, fullRepaint, state.ghostProgress, 1.0);
+        painter.setOpacity(1.0);
+    }
+
+    drawSnake(painter, engine, state, visible, dirty, fullRepaint, state.tickProgress, state.headScale);
+
+    // Draw Shadow Effect On Food
+    if (state.shadowOffset > 0 && engine.hasFood()) {
+        painter.setBrush(QColor(0, 0, 0, 50));
+        painter.setPen(Qt::NoPen);
+        painter.drawEllipse(food.x * cellSize + cellSize/2 + state.shadowOffset,
+                            food.y * cellSize + cellSize/2 + state.shadowOffset,
+                            cellSize/3, cellSize/3);
+    }
+
+    // Outline The Arena Edge So Walls Are Visible While Scrolling
+    if (state.arena) {
+        painter.setBrush(Qt::NoBrush);
+        painter.setPen(QPen(QColor(255, 255, 255, 90), 2));
+        painter.drawRect(QRect(0, 0, gridSize * cellSize, gridSize * cellSize));
+    }
+    painter.restore();
+
+    if (!state.hud) return;
+
+    // Draw Current Score (scaled with widget)
+    painter.setPen(Qt::white);
+    int scoreFontSize = qBound(16, state.size.width() / 15, 32);
+    QFont scoreFont = QFont("Arial", scoreFontSize, QFont::Bold);
+    scoreFont.setLetterSpacing(QFont::AbsoluteSpacing, 2);
+    painter.setFont(scoreFont);
+
+    painter.drawText(scoreArea(state.size), Qt::AlignCenter, QString("%1").arg(state.score));
+
+    // Draw Pause Indicator
+    if (state.paused) {
+        painter.setPen(QPen(QColor(255, 255, 255, 200), 3));
+        int pauseFontSize = qBound(24, state.size.width() / 10, 48);
+        painter.setFont(QFont("Arial", pauseFontSize, QFont::Bold));
+        painter.drawText(QRect(QPoint(0, 0), state.size), Qt::AlignCenter, "PAUSED");
+    }
+}
+
+/**
+ * @brief Draws One Snake's Head, Body And Tail From The Sprite Atlas
+ * @param visible Grid Cells Inside The Target
+ * @param dirty Region Being Repainted; Only Body Cells Under It Are Drawn Unless fullRepaint
+ * @param alpha Tween Of The Head And Tail Between Their Previous And Current Cells
+ * @param headScale Head Pulse Animation
+ *
+ * Body sprites are chosen by cell, so the body can be drawn from occupancy
+ * alone. A partial repaint visits only the cells under the dirty region (the
+ * head, neck and tail cells the engine reported plus the HUD and particle
+ * areas), which keeps its cost independent of the snake's length. A full
+ * repaint walks the segments, or the visible cells once the snake is longer
+ * than the viewport. The tail and then the head are drawn last in every case.
+ */
+void SnakeRenderer::drawSnake(QPainter &painter, const SnakeEngine &engine, const SnakeRenderState &state,
+                              const QRect &visible, const QRegion &dirty, bool fullRepaint, qreal alpha,
+                              qreal headScale)
+{
+    // Head And Tail Slide Between Cells While Ticks Are Pending, The Body Stays Put
+    // So Only Those Two Areas Change Between Ticks
+    const int cellSize = state.cellSize;
+    const int gridSize = engine.gridSize();
+    int length = engine.length();
+    if (cellSize <= 0 || length == 0) return;
+    SnakeCell head = engine.head();
+    SnakeCell tail = engine.tail();
+
+    // Body Cell Other Than The Sliding Head And Tail
+    auto isBodyCell = [&](SnakeCell cell) {
+        return !(cell == head) && !(cell == tail) && engine.isBlocked(cell) && !engine.isWall(cell);
+    };
+
+    if (!fullRepaint) {
+        // Cells Under Each Dirty Rectangle, Deduplicated So No Sprite Is Blended Twice
+        QPoint origin = state.arena ? state.camera.toPoint() : QPoint();
+        QVector<int> cells;
+        for (const QRect &rect : dirty) {
+            QRect world = rect.translated(origin);
+            QRect range = QRect(QPoint(world.left() / cellSize, world.top() / cellSize),
+                                QPoint(world.right() / cellSize, world.bottom() / cellSize)) & visible;
+            for (int y = range.top(); y <= range.bottom(); ++y) {
+                for (int x = range.left(); x <= range.right(); ++x) {
+                    cells.append(y * gridSize + x);
+                }
+            }
+        }
+        std::sort(cells.begin(), cells.end());
+        cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+        for (int index : cells) {
+            SnakeCell cell{index % gridSize, index / gridSize};
+            if (isBodyCell(cell)) m_sprites.drawBody(painter, QPointF(cell.x * cellSize, cell.y * cellSize), bodyVariant(cell));
+        }
+    } else if (length > 2 && qint64(length) > qint64(visible.width()) * visible.height()) {
+        // A Snake Longer Than The Viewport Is Drawn By Scanning The Visible Cells, So The
+        // Cost Follows The Window Size Rather Than The Snake's Length
+        for (int y = visible.top(); y <= visible.bottom(); ++y) {
+            for (int x = visible.left(); x <= visible.right(); ++x) {
+                SnakeCell cell{x, y};
+                if (isBodyCell(cell)) m_sprites.drawBody(painter, QPointF(x * cellSize, y * cellSize), bodyVariant(cell));
+            }
+        }
+    } else {
+        for (int i = 1; i < length - 1; ++i) {
+            SnakeCell part = engine.segment(i);
+            if (visible.contains(part.x, part.y)) {
+                m_sprites.drawBody(painter, QPointF(part.x * cellSize, part.y * cellSize), bodyVariant(part));
+            }
+        }
+    }
+
+    // Position Of A Sliding Segment alpha Of The Way From Its Previous Cell
+    auto tween = [&](SnakeCell from, SnakeCell to) {
+        return QPointF((from.x + (to.x - from.x) * alpha) * cellSize,
+                       (from.y + (to.y - from.y) * alpha) * cellSize);
+    };
+
+    if (length > 1) {
+        m_sprites.drawBody(painter, tween(engine.previousTail(), tail), bodyVariant(tail));
+    }
+
+    // Apply Head Scale Animation Around The Cell Centre
+    QRectF target(tween(length > 1 ? engine.segment(1) : head, head), QSizeF(cellSize, cellSize));
+    if (headScale != 1.0) {
+        qreal grow = cellSize * (headScale - 1) / 2;
+        target.adjust(-grow, -grow, grow, grow);
+    }
+    m_sprites.drawHead(painter, target, engine.direction());
+}
+
+/**
+ * @brief Renders A Full Frame Into An Offscreen Image
+ *
+ * Needs a QGuiApplication (the offscreen platform is enough) for fonts.
+ * Each renderer owns its caches as QImages, so separate renderers can draw
+ * on separate threads at the same time.
+ */
+QImage SnakeRenderer::renderImage(const SnakeEngine &engine, const SnakeRenderState &state)
+{
+    QImage image(state.size * state.devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(state.devicePixelRatio);
+    image.fill(Qt::black);
+
+    QPainter painter(&image);
+    render(painter, engine, state);
+    painter.end();
+    return image;
+}
+
+/**
+ * @brief Cell Range Under The Target
+ */
+QRect SnakeRenderer::visibleCells(const SnakeRenderState &state, int gridSize)
+{
+    if (!state.arena || state.cellSize <= 0) return QRect(0, 0, gridSize, gridSize);
+
+    int left = qMax(0, int(state.camera.x()) / state.cellSize);
+    int top = qMax(0, int(state.camera.y()) / state.cellSize);
+    int right = qMin(gridSize - 1, int(state.camera.x() + state.size.width()) / state.cellSize);
+    int bottom = qMin(gridSize - 1, int(state.camera.y() + state.size.height()) / state.cellSize);
+    return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+/**
+ * @brief Target Rectangle Of A Grid Cell, After The Camera Offset
+ */
+QRect SnakeRenderer::cellRect(const SnakeRenderState &state, SnakeCell cell)
+{
+    QPoint origin = state.arena ? state.camera.toPoint() : QPoint();
+    return QRect(cell.x * state.cellSize - origin.x(), cell.y * state.cellSize - origin.y(),
+                 state.cellSize, state.cellSize);
+}
+
+/**
+ * @brief HUD Rectangle Holding The Score Text
+ */
+QRect SnakeRenderer::scoreArea(const QSize &size)
+{
+    int scoreFontSize = qBound(16, size.width() / 15, 32);
+    return QRect(0, size.height() - scoreFontSize * 2, size.width(), scoreFontSize * 1.5);
+}
+
+/**
+ * @brief Background Colours For A Difficulty, Spanning The Target
+ */
+QLinearGradient SnakeRenderer::backgroundGradient(int difficulty, const QSize &size)
+{
+    QLinearGradient gradient(0, 0, size.width(), size.height());
+
+    // Color scheme based on difficulty
+    switch(difficulty) {
+    case 0: // Easy - greens
+        gradient.setColorAt(0.0, QColor(20, 40, 30));
+        gradient.setColorAt(0.5, QColor(30, 50, 40));
+        gradient.setColorAt(1.0, QColor(20, 40, 30));
+        break;
+    case 1: // Medium - blues
+        gradient.setColorAt(0.0, QColor(20, 30, 40));
+        gradient.setColorAt(0.5, QColor(30, 40, 50));
+        gradient.setColorAt(1.0, QColor(20, 30, 40));
+        break;
+    case 2: // Hard - reds/purples
+        gradient.setColorAt(0.0, QColor(40, 20, 30));
+        gradient.setColorAt(0.5, QColor(50, 30, 40));
+        gradient.setColorAt(1.0, QColor(40, 20, 30));
+        break;
+    }
+    return gradient;
+}
+
+/**
+ * @brief Renders The Background Gradient, Grid Overlay And Board Walls Once Into An Image
+ *
+ * Only changes on resize, difficulty, cell size or map changes, so render() can
+ * blit it instead of refilling the gradient and stroking every grid line.
+ * The arena layer is one cell larger so it can be shifted by the camera's
+ * sub-cell offset.
+ */
+void SnakeRenderer::rebuildStaticLayer(const LayerKey &key)
+{
+    m_layerKey = key;
+    int margin = key.arena ? key.cellSize : 0;
+    QSize layerSize = key.size + QSize(margin, margin);
+    m_staticLayer = QImage(layerSize * key.devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    m_staticLayer.setDevicePixelRatio(key.devicePixelRatio);
+
+    QPainter painter(&m_staticLayer);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // Draw Background
+    painter.fillRect(QRect(QPoint(0, 0), layerSize), backgroundGradient(key.difficulty, key.size));
+
+    // Draw Grid Overlay (more subtle on larger screens)
+    if (key.gridSize > 0 && key.cellSize > 0) {
+        int gridAlpha = qBound(10, 30 - (key.cellSize / 5), 30);
+        painter.setPen(QPen(QColor(255, 255, 255, gridAlpha), 1));
+
+        int gridWidth = key.arena ? qMax(key.size.width(), key.size.height()) + margin : key.gridSize * key.cellSize;
+        for (int x = 0; x <= gridWidth; x += key.cellSize) {
+            painter.drawLine(x, 0, x, gridWidth);
+        }
+        for (int y = 0; y <= gridWidth; y += key.cellSize) {
+            painter.drawLine(0, y, gridWidth, y);
+        }
+    }
+
+    // Walls Never Move On The Board, So They Live In The Layer Too
+    if (key.map && key.cellSize > 0) {
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(wallColor());
+        for (int y = 0; y < key.gridSize; ++y) {
+            for (int x = 0; x < key.gridSize; ++x) {
+                if (key.map->isWall(SnakeCell{x, y})) {
+                    painter.drawRect(x * key.cellSize, y * key.cellSize, key.cellSize, key.cellSize);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef SNAKERENDERER_H
+#define SNAKERENDERER_H
+
+#include <QImage>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QPointF>
+#include <QRegion>
+#include <QSize>
+#include "snakeengine.h"
+#include "snakeparticles.h"
+#include "snakesprites.h"
+
+// Everything A Frame Depends On Apart From The Engine
+struct SnakeRenderState
+{
+    QSize size;                         // Logical Target Size
+    qreal devicePixelRatio = 1.0;
+    int cellSize = 0;                   // Logical Pixels Per Grid Cell
+    int difficulty = 1;                 // Picks The Background Colours
+    bool arena = false;                 // Scrolling Large Arena, Drawn Through camera
+    QPointF camera;                     // World Pixel At The Target's Top Left Corner
+    qreal tickProgress = 1.0;           // Head And Tail Tween, 1.0 Draws Them In Their Cells
+    qreal headScale = 1.0;              // Head Pulse Animation
+    int shadowOffset = 0;               // Food Drop Shadow Animation
+    const ParticlePool *particles = nullptr;
+    int score = 0;
+    bool paused = false;
+    bool hud = true;                    // Score And Pause Text, Font Dependent
+    const SnakeEngine *ghost = nullptr; // Replayed Best Run Drawn Under The Live Snake, Same Grid
+    qreal ghostProgress = 1.0;          // Ghost Head And Tail Tween
+    qreal ghostOpacity = 0.35;
+};
+
+// Draws Snake Frames Onto Any QPainter
+//
+// The widget's paintEvent and the offscreen tools share this code, so a
+// frame rendered into a QImage under the offscreen platform is the same
+// frame the player sees. The background and grid are cached in a layer
+// keyed by everything they depend on; sprites come from SnakeSpriteAtlas.
+class SnakeRenderer
+{
+public:
+    // Draw One Frame. A Non-Empty dirty Region Limits Body Drawing To The Cells Under It
+    void render(QPainter &painter, const SnakeEngine &engine, const SnakeRenderState &state,
+                const QRegion &dirty = QRegion());
+
+    // Render A Whole Frame Into A New Image Of state.size * state.devicePixelRatio
+    QImage renderImage(const SnakeEngine &engine, const SnakeRenderState &state);
+
+    // Grid Cells Intersecting The Target (The Whole Grid Outside Arena Mode)
+    static QRect visibleCells(const SnakeRenderState &state, int gridSize);
+
+    // Target Rectangle Of A Grid Cell
+    static QRect cellRect(const SnakeRenderState &state, SnakeCell cell);
+
+    // HUD Rectangle Holding The Score Text
+    static QRect scoreArea(const QSize &size);
+
+    // Background Gradient For A Difficulty
+    static QLinearGradient backgroundGradient(int difficulty, const QSize &size);
+
+    // Fill Colour Of Map Walls
+    static QColor wallColor() { return QColor(70, 82, 104); }
+
+private:
+    // Cache Key Of The Background And Grid Layer
+    struct LayerKey
+    {
+        QSize size;
+        qreal devicePixelRatio = 0;
+        int cellSize = 0;
+        int gridSize = 0;
+        int difficulty = -1;
+        bool arena = false;
+        const SnakeMap *map = nullptr;  // Walls Are Baked In Outside Arena Mode
+
+        bool operator==(const LayerKey &other) const
+        {
+            return size == other.size && devicePixelRatio == other.devicePixelRatio
+                   && cellSize == other.cellSize && gridSize == other.gridSize
+                   && difficulty == other.difficulty && arena == other.arena && map == other.map;
+        }
+    };
+
+    // Draw A Snake's Segments From The Sprite Atlas, Sliding Head And Tail By alpha
+    void drawSnake(QPainter &painter, const SnakeEngine &engine, const SnakeRenderState &state,
+                   const QRect &visible, const QRegion &dirty, bool fullRepaint, qreal alpha, qreal headScale);
+
+    // Render The Background Gradient, Grid Overlay And (Board Mode) Walls For key
+    void rebuildStaticLayer(const LayerKey &key);
+
+    QImage m_staticLayer;               // Cached Background And Grid, Device Pixel Ratio Aware
+    LayerKey m_layerKey;                // What m_staticLayer Was Built For
+    SnakeSpriteAtlas m_sprites;         // Pre-Rendered Body, Head And Food Sprites
+};
+
+#endif // SNAKERENDERER_H
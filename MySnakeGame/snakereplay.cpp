@@ -0,0 +1,188 @@
+#include "snakereplay.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+const std::uint8_t Magic[4] = { 'S', 'N', 'K', 'R' };
+const std::uint8_t FormatVersion = 2;      // 2 Appends The Map Hash, 1 Is Still Read
+
+void writeVarint(std::vector<std::uint8_t> &out, std::uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+bool readVarint(const std::uint8_t *data, std::size_t size, std::size_t &offset, std::uint64_t &value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64 && offset < size; shift += 7) {
+        std::uint8_t byte = data[offset++];
+        value |= std::uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+}
+
+/**
+ * @brief Encodes The Replay As A Self Describing Byte Buffer
+ */
+std::vector<std::uint8_t> SnakeReplay::serialize() const
+{
+    std::vector<std::uint8_t> out(Magic, Magic + 4);
+    out.push_back(FormatVersion);
+    writeVarint(out, seed);
+    writeVarint(out, static_cast<std::uint64_t>(difficulty));
+    writeVarint(out, static_cast<std::uint64_t>(gridSize));
+    writeVarint(out, tickCount);
+    writeVarint(out, static_cast<std::uint64_t>(finalScore));
+    writeVarint(out, static_cast<std::uint64_t>(inputCount));
+    writeVarint(out, inputs.size());
+    out.insert(out.end(), inputs.begin(), inputs.end());
+    writeVarint(out, mapHash);
+    return out;
+}
+
+/**
+ * @brief Decodes A Buffer Produced By serialize()
+ * @return false If The Header Or Any Field Is Malformed
+ */
+bool SnakeReplay::deserialize(const std::uint8_t *data, std::size_t size, SnakeReplay &replay)
+{
+    if (size < 5 || !std::equal(Magic, Magic + 4, data) || data[4] < 1 || data[4] > FormatVersion) return false;
+
+    std::size_t offset = 5;
+    std::uint64_t fields[7];
+    for (std::uint64_t &field : fields) {
+        if (!readVarint(data, size, offset, field)) return false;
+    }
+
+    const std::uint64_t intMax = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+    if (fields[1] > intMax || fields[2] > intMax || fields[4] > intMax || fields[5] > intMax) return false;
+    if (fields[6] > size - offset) return false;
+
+    replay.seed = fields[0];
+    replay.difficulty = static_cast<int>(fields[1]);
+    replay.gridSize = static_cast<int>(fields[2]);
+    replay.tickCount = fields[3];
+    replay.finalScore = static_cast<int>(fields[4]);
+    replay.inputCount = static_cast<int>(fields[5]);
+    replay.inputs.assign(data + offset, data + offset + fields[6]);
+    offset += fields[6];
+
+    replay.mapHash = 0;
+    if (data[4] >= 2 && !readVarint(data, size, offset, replay.mapHash)) return false;
+    return true;
+}
+
+/**
+ * @brief Starts A Fresh Recording
+ * @param seed Seed The Engine Was Reset With
+ * @param difficulty Difficulty Level Of The Game
+ * @param gridSize Grid Dimension Count
+ * @param mapHash Hash Of The Level Map, 0 Without One
+ */
+void SnakeReplayRecorder::begin(std::uint64_t seed, int difficulty, int gridSize, std::uint64_t mapHash)
+{
+    m_replay = SnakeReplay();
+    m_replay.seed = seed;
+    m_replay.difficulty = difficulty;
+    m_replay.gridSize = gridSize;
+    m_replay.mapHash = mapHash;
+    m_lastTick = 0;
+    m_lastDirection = SnakeDirection::Right;
+}
+
+/**
+ * @brief Records The Direction Requested For A Tick, Storing Only Changes
+ * @param tick Tick The Direction Is Applied On
+ * @param direction Direction Passed To SnakeEngine::step()
+ */
+void SnakeReplayRecorder::record(std::uint64_t tick, SnakeDirection direction)
+{
+    if (direction == m_lastDirection) return;
+
+    writeVarint(m_replay.inputs, ((tick - m_lastTick) << 2) | static_cast<std::uint64_t>(direction));
+    ++m_replay.inputCount;
+    m_lastTick = tick;
+    m_lastDirection = direction;
+}
+
+/**
+ * @brief Stores The Final Tick Count And Score Used To Verify Playback
+ */
+void SnakeReplayRecorder::finish(const SnakeEngine &engine)
+{
+    m_replay.tickCount = engine.tickCount();
+    m_replay.finalScore = engine.score();
+}
+
+/**
+ * @brief Constructor, The Replay Must Outlive The Player
+ */
+SnakeReplayPlayer::SnakeReplayPlayer(const SnakeReplay &replay)
+    : m_replay(replay)
+{
+}
+
+/**
+ * @brief Resets The Engine And Rewinds The Input Stream
+ */
+void SnakeReplayPlayer::start(SnakeEngine &engine)
+{
+    engine.reset(m_replay.gridSize, m_replay.seed);
+    m_offset = 0;
+    m_decoded = 0;
+    m_nextTick = 0;
+    m_direction = SnakeDirection::Right;
+    decodeNext();
+}
+
+/**
+ * @brief Decodes The Next Direction Change
+ */
+void SnakeReplayPlayer::decodeNext()
+{
+    std::uint64_t value = 0;
+    if (m_decoded >= m_replay.inputCount
+        || !readVarint(m_replay.inputs.data(), m_replay.inputs.size(), m_offset, value)) {
+        m_nextTick = std::numeric_limits<std::uint64_t>::max();
+        return;
+    }
+    ++m_decoded;
+    m_nextTick += value >> 2;
+    m_nextDirection = static_cast<SnakeDirection>(value & 3);
+}
+
+/**
+ * @brief Plays The Next Recorded Tick
+ * @return false When The Recorded Game Has Already Ended
+ */
+bool SnakeReplayPlayer::step(SnakeEngine &engine)
+{
+    if (finished(engine)) return false;
+
+    std::uint64_t tick = engine.tickCount() + 1;
+    if (tick == m_nextTick) {
+        m_direction = m_nextDirection;
+        decodeNext();
+    }
+    engine.step(m_direction);
+    return true;
+}
+
+/**
+ * @brief Plays The Rest Of The Game
+ * @return true If Tick Count And Score Match The Recording Exactly
+ */
+bool SnakeReplayPlayer::playToEnd(SnakeEngine &engine)
+{
+    while (step(engine)) {
+    }
+    return engine.tickCount() == m_replay.tickCount && engine.score() == m_replay.finalScore;
+}
@@ -0,0 +1,85 @@
+#ifndef SNAKEREPLAY_H
+#define SNAKEREPLAY_H
+
+// Standard Library Only - Replays Are Recorded By The Widget And Played Back By Tools
+#include "snakeengine.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Recorded Game: Everything Needed To Reproduce It Through SnakeEngine
+//
+// Inputs are stored only when the direction passed to step() changes. Each
+// change is one varint holding (ticks since previous change << 2 | direction),
+// so a turn usually costs a single byte.
+struct SnakeReplay
+{
+    std::uint64_t seed = 0;             // Engine Seed Of The Game
+    int difficulty = 1;                 // Difficulty Selected In The Widget
+    int gridSize = 20;                  // Grid Dimension Count
+    std::uint64_t mapHash = 0;          // SnakeMap::hash() Of The Level, 0 On The Empty Board
+    std::uint64_t tickCount = 0;        // Ticks Played Until The Game Ended
+    int finalScore = 0;                 // Score At The End, Checked On Playback
+    int inputCount = 0;                 // Number Of Encoded Direction Changes
+    std::vector<std::uint8_t> inputs;   // Delta Encoded Direction Changes
+
+    // Binary File Image ("SNKR" Header Followed By Varints)
+    std::vector<std::uint8_t> serialize() const;
+    static bool deserialize(const std::uint8_t *data, std::size_t size, SnakeReplay &replay);
+};
+
+// Appends Inputs To A Replay While A Game Is Played
+class SnakeReplayRecorder
+{
+public:
+    // Start Recording A Game The Engine Was Just Reset For
+    void begin(std::uint64_t seed, int difficulty, int gridSize, std::uint64_t mapHash = 0);
+
+    // Record The Direction Passed To The Engine For tick (1 Based, Increasing)
+    void record(std::uint64_t tick, SnakeDirection direction);
+
+    // Close The Recording With The Engine's Final State
+    void finish(const SnakeEngine &engine);
+
+    const SnakeReplay &replay() const { return m_replay; }
+
+private:
+    SnakeReplay m_replay;
+    std::uint64_t m_lastTick = 0;
+    SnakeDirection m_lastDirection = SnakeDirection::Right;
+};
+
+// Feeds A Replay's Inputs Back Into An Engine Tick By Tick
+class SnakeReplayPlayer
+{
+public:
+    explicit SnakeReplayPlayer(const SnakeReplay &replay);
+
+    // Reset The Engine To The Recorded Seed And Grid. A Map Game Needs The Same Map Already
+    // Set On The Engine (Compare mapHash With SnakeMap::hash())
+    void start(SnakeEngine &engine);
+
+    // Advance One Tick, Returns false Once The Recorded Game Is Over
+    bool step(SnakeEngine &engine);
+
+    // Play Every Remaining Tick And Check The Result Matches The Recording
+    bool playToEnd(SnakeEngine &engine);
+
+    bool finished(const SnakeEngine &engine) const
+    {
+        return engine.isGameOver() || engine.tickCount() >= m_replay.tickCount;
+    }
+
+private:
+    // Decode The Next Direction Change, Or Push It Past The End When None Is Left
+    void decodeNext();
+
+    const SnakeReplay &m_replay;
+    std::size_t m_offset = 0;           // Read Position In m_replay.inputs
+    int m_decoded = 0;                  // Changes Decoded So Far
+    std::uint64_t m_nextTick = 0;       // Tick At Which m_nextDirection Takes Effect
+    SnakeDirection m_nextDirection = SnakeDirection::Right;
+    SnakeDirection m_direction = SnakeDirection::Right;
+};
+
+#endif // SNAKEREPLAY_H
@@ -0,0 +1,390 @@
+#include "snakeresultoverlay.h"
+#include <QLinearGradient>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QTimer>
+
+namespace {
+
+// Room Around The Panel For Its Drop Shadow
+const int ShadowMargin = 20;
+
+// Colours That Differ Between The Game Over And Win Panels
+struct ResultPalette
+{
+    QColor title;
+    QColor line;
+    QColor buttonFrom;
+    QColor buttonTo;
+    QColor buttonHover;
+};
+
+ResultPalette resultPalette(SnakeResultOverlay::Kind kind)
+{
+    if (kind == SnakeResultOverlay::Win) {
+        return { QColor("#2ecc71"), QColor("#2ecc71"), QColor("#2ecc71"), QColor("#27ae60"), QColor("#27ae60") };
+    }
+    return { QColor("#ff5e5e"), QColor("#e74c3c"), QColor("#e74c3c"), QColor("#c0392b"), QColor("#c0392b") };
+}
+
+QFont pixelFont(const QString &family, int pixelSize, int weight)
+{
+    QFont font(family);
+    font.setPixelSize(pixelSize);
+    font.setWeight(QFont::Weight(weight));
+    return font;
+}
+
+}
+
+/**
+ * @brief Constructor For A Hidden Overlay Covering Part Of parent
+ * @param parent Game Widget The Panel Is Centred Over
+ */
+SnakeResultOverlay::SnakeResultOverlay(QWidget *parent)
+    : QWidget(parent)
+    , m_kind(GameOver)
+    , m_score(0)
+    , m_opacity(1.0)
+    , m_presented(true)
+    , m_prepareQueued(false)
+    , m_hovered(NoButton)
+{
+    // Keys Stay With The Game (R Restarts From Here Too)
+    setFocusPolicy(Qt::NoFocus);
+    setMouseTracking(true);
+    setAttribute(Qt::WA_TranslucentBackground);
+    hide();
+
+    m_fade = new QVariantAnimation(this);
+    m_fade->setDuration(350);
+    m_fade->setStartValue(0.0);
+    m_fade->setEndValue(1.0);
+    connect(m_fade, &QVariantAnimation::valueChanged, this, [this](const QVariant &value) {
+        m_opacity = value.toReal();
+        update();
+    });
+
+    parent->installEventFilter(this);
+
+    // Both Panels Are Ready Long Before The First Game Ends
+    schedulePrepare();
+}
+
+/**
+ * @brief Shows The Panel For A Finished Game, Fading In From Transparent
+ */
+void SnakeResultOverlay::showResult(Kind kind, int score)
+{
+    m_kind = kind;
+    m_score = score;
+    m_presented = false;
+    setHovered(NoButton);
+    layoutInParent();
+
+    m_fade->stop();
+    m_opacity = 0.0;
+    show();
+    raise();
+    m_fade->start();
+}
+
+/**
+ * @brief Updates Title And Score In Place
+ */
+void SnakeResultOverlay::setResult(Kind kind, int score)
+{
+    if (kind == m_kind && score == m_score) return;
+    m_kind = kind;
+    m_score = score;
+    update();
+}
+
+/**
+ * @brief Hides The Panel Until The Next showResult()
+ */
+void SnakeResultOverlay::dismiss()
+{
+    m_fade->stop();
+    setHovered(NoButton);
+    hide();
+}
+
+/**
+ * @brief Builds Whichever Panels No Longer Match The Parent's Size Or Pixel Ratio
+ *
+ * Called when idle so the paint that presents a result never rasterises.
+ * The visible panel is left alone; its own repaint picks up any change.
+ */
+void SnakeResultOverlay::prepare()
+{
+    m_prepareQueued = false;
+    if (isVisible()) return;
+
+    layoutInParent();
+    for (Kind kind : { GameOver, Win }) {
+        if (panelStale(kind)) rebuildPanel(kind);
+    }
+}
+
+/**
+ * @brief Queues prepare() Behind Pending Events
+ */
+void SnakeResultOverlay::schedulePrepare()
+{
+    if (m_prepareQueued) return;
+    m_prepareQueued = true;
+    QTimer::singleShot(0, this, &SnakeResultOverlay::prepare);
+}
+
+/**
+ * @brief Sizes The Panel Like The Former Dialog And Lays Out Its Parts
+ *
+ * The column matches the old layout: title, divider, score card and two
+ * buttons with 15 pixel gaps inside 40 x 35 pixel margins, centred vertically.
+ */
+void SnakeResultOverlay::layoutInParent()
+{
+    QWidget *parent = parentWidget();
+    int panelWidth = qMax(160, qMin(400, parent->width() - 100));
+    int panelHeight = qMax(240, qMin(480, parent->height() - 100));
+
+    setGeometry((parent->width() - panelWidth) / 2 - ShadowMargin,
+                (parent->height() - panelHeight) / 2 - ShadowMargin,
+                panelWidth + 2 * ShadowMargin, panelHeight + 2 * ShadowMargin);
+    m_panelRect = QRect(ShadowMargin, ShadowMargin, panelWidth, panelHeight);
+
+    int rowHeight = panelHeight / 8;
+    int cardHeight = panelHeight / 4;
+    int content = rowHeight + 15 + 4 + 20 + cardHeight + 30 + rowHeight + 15 + rowHeight;
+    QRect inner = m_panelRect.adjusted(40, 35, -40, -35);
+    int y = inner.top() + qMax(0, (inner.height() - content) / 2);
+
+    m_titleRect = QRect(inner.left(), y, inner.width(), rowHeight);
+    y += rowHeight + 15;
+    m_lineRect = QRect(m_panelRect.center().x() - panelWidth / 4, y, panelWidth / 2, 4);
+    y += 4 + 20;
+    m_scoreCardRect = QRect(inner.left(), y, inner.width(), cardHeight);
+    y += cardHeight + 30;
+    m_restartRect = QRect(inner.left(), y, inner.width(), rowHeight);
+    y += rowHeight + 15;
+    m_homeRect = QRect(inner.left(), y, inner.width(), rowHeight);
+}
+
+/**
+ * @brief Checks A Cached Panel Against The Current Size And Pixel Ratio
+ */
+bool SnakeResultOverlay::panelStale(Kind kind) const
+{
+    const CachedPanel &panel = m_panels[kind];
+    return panel.image.isNull() || panel.size != size() || panel.devicePixelRatio != devicePixelRatioF();
+}
+
+/**
+ * @brief Renders Shadow, Panel, Title, Divider, Score Card And Idle Buttons Of kind
+ */
+void SnakeResultOverlay::rebuildPanel(Kind kind)
+{
+    CachedPanel &panel = m_panels[kind];
+    panel.size = size();
+    panel.devicePixelRatio = devicePixelRatioF();
+
+    panel.image = QImage(panel.size * panel.devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    panel.image.setDevicePixelRatio(panel.devicePixelRatio);
+    panel.image.fill(Qt::transparent);
+
+    QPainter painter(&panel.image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    ResultPalette palette = resultPalette(kind);
+
+    // Soft Drop Shadow: Stacked Translucent Outlines Standing In For A Blur
+    for (int spread = ShadowMargin; spread > 0; spread -= 2) {
+        painter.setBrush(QColor(0, 0, 0, 12));
+        QRect shadow = m_panelRect.translated(0, 8).adjusted(-spread / 2, -spread / 2, spread / 2, spread / 2);
+        painter.drawRoundedRect(shadow, 40 + spread / 2, 40 + spread / 2);
+    }
+
+    // Panel
+    painter.setBrush(QColor("#1a1e2b"));
+    painter.setPen(QPen(QColor("#2a2f3c"), 1));
+    painter.drawRoundedRect(QRectF(m_panelRect).adjusted(0.5, 0.5, -0.5, -0.5), 40, 40);
+
+    // Title
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor("#2a2f3c"));
+    int titleRadius = qMin(m_panelRect.height() / 16, m_titleRect.height() / 2);
+    painter.drawRoundedRect(m_titleRect, titleRadius, titleRadius);
+
+    QFont titleFont = pixelFont("Arial Black", qBound(20, m_panelRect.width() / 12, 28), QFont::Black);
+    titleFont.setLetterSpacing(QFont::AbsoluteSpacing, 2);
+    painter.setFont(titleFont);
+    painter.setPen(palette.title);
+    painter.drawText(m_titleRect, Qt::AlignCenter,
+                     kind == Win ? QString::fromUtf8("🎉 YOU WIN! 🎉") : QString("GAME OVER"));
+
+    // Divider Fading Out Towards Both Ends
+    QLinearGradient line(m_lineRect.topLeft(), m_lineRect.topRight());
+    line.setColorAt(0, Qt::transparent);
+    line.setColorAt(0.5, palette.line);
+    line.setColorAt(1, Qt::transparent);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(line);
+    painter.drawRoundedRect(m_lineRect, 2, 2);
+
+    // Score Card; The Value Itself Is Drawn Per Frame
+    QLinearGradient card(m_scoreCardRect.topLeft(), m_scoreCardRect.bottomLeft());
+    card.setColorAt(0, QColor("#232837"));
+    card.setColorAt(1, QColor("#1c212d"));
+    painter.setBrush(card);
+    painter.setPen(QPen(QColor("#2a2f3c"), 1));
+    int cardRadius = qMin(55, m_scoreCardRect.height() / 2);
+    painter.drawRoundedRect(QRectF(m_scoreCardRect).adjusted(0.5, 0.5, -0.5, -0.5), cardRadius, cardRadius);
+
+    painter.setFont(pixelFont("Arial", 13, QFont::Bold));
+    painter.setPen(QColor("#8f9bb5"));
+    painter.drawText(m_scoreCardRect.adjusted(0, 15, 0, 0), Qt::AlignHCenter | Qt::AlignTop, "YOUR SCORE");
+
+    // Buttons In Their Idle State
+    drawButton(painter, m_restartRect, kind, RestartButton, false);
+    drawButton(painter, m_homeRect, kind, HomeButton, false);
+}
+
+/**
+ * @brief Draws One Of The Two Buttons
+ */
+void SnakeResultOverlay::drawButton(QPainter &painter, const QRect &rect, Kind kind, Button button, bool hovered) const
+{
+    ResultPalette palette = resultPalette(kind);
+    painter.setPen(Qt::NoPen);
+
+    if (button == RestartButton) {
+        if (hovered) {
+            painter.setBrush(palette.buttonHover);
+        } else {
+            QLinearGradient fill(rect.topLeft(), rect.topRight());
+            fill.setColorAt(0, palette.buttonFrom);
+            fill.setColorAt(1, palette.buttonTo);
+            painter.setBrush(fill);
+        }
+    } else {
+        painter.setBrush(QColor(hovered ? "#3f4559" : "#2f3545"));
+    }
+    int radius = qMin(28, rect.height() / 2);
+    painter.drawRoundedRect(rect, radius, radius);
+
+    painter.setFont(pixelFont("Arial", 16, QFont::Bold));
+    painter.setPen(button == RestartButton ? QColor(Qt::white) : QColor("#e5e7eb"));
+    painter.drawText(rect, Qt::AlignCenter, button == RestartButton ? "PLAY AGAIN" : "HOME");
+}
+
+/**
+ * @brief Blits The Cached Panel And Draws The Score And Hover State At The Fade Opacity
+ *
+ * The panel is normally prebuilt by prepare(); rebuilding here only happens
+ * when the board is resized or changes screens while the result is showing.
+ */
+void SnakeResultOverlay::paintEvent(QPaintEvent *)
+{
+    if (panelStale(m_kind)) {
+        rebuildPanel(m_kind);
+    }
+
+    QPainter painter(this);
+    painter.setOpacity(m_opacity);
+    painter.drawImage(0, 0, m_panels[m_kind].image);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    if (m_hovered != NoButton) {
+        drawButton(painter, m_hovered == RestartButton ? m_restartRect : m_homeRect, m_kind, m_hovered, true);
+    }
+
+    // Score Below The Card Caption
+    painter.setFont(pixelFont("Arial", qBound(32, m_panelRect.width() / 8, 46), QFont::ExtraBold));
+    painter.setPen(Qt::white);
+    painter.drawText(m_scoreCardRect.adjusted(0, 33, 0, -15), Qt::AlignCenter, QString::number(m_score));
+
+    if (!m_presented) {
+        m_presented = true;
+        emit presented();
+    }
+}
+
+/**
+ * @brief Tracks The Hovered Button
+ */
+void SnakeResultOverlay::mouseMoveEvent(QMouseEvent *event)
+{
+    setHovered(buttonAt(event->pos()));
+    QWidget::mouseMoveEvent(event);
+}
+
+/**
+ * @brief Triggers The Button Under The Pointer
+ */
+void SnakeResultOverlay::mousePressEvent(QMouseEvent *event)
+{
+    if (event->button() != Qt::LeftButton) {
+        QWidget::mousePressEvent(event);
+        return;
+    }
+
+    switch (buttonAt(event->pos())) {
+    case RestartButton:
+        emit restartRequested();
+        break;
+    case HomeButton:
+        emit homeRequested();
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Clears The Hover State When The Pointer Leaves
+ */
+void SnakeResultOverlay::leaveEvent(QEvent *event)
+{
+    setHovered(NoButton);
+    QWidget::leaveEvent(event);
+}
+
+/**
+ * @brief Follows Game Widget Resizes: Re-Centres A Visible Panel, Rebuilds Hidden Ones When Idle
+ */
+bool SnakeResultOverlay::eventFilter(QObject *watched, QEvent *event)
+{
+    if (watched == parentWidget() && event->type() == QEvent::Resize) {
+        if (isVisible()) layoutInParent();
+        else schedulePrepare();
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+/**
+ * @brief Button Under A Widget Position
+ */
+SnakeResultOverlay::Button SnakeResultOverlay::buttonAt(const QPoint &pos) const
+{
+    if (m_restartRect.contains(pos)) return RestartButton;
+    if (m_homeRect.contains(pos)) return HomeButton;
+    return NoButton;
+}
+
+/**
+ * @brief Repaints Only The Buttons Whose Hover State Changed
+ */
+void SnakeResultOverlay::setHovered(Button button)
+{
+    if (button == m_hovered) return;
+
+    auto buttonRect = [this](Button which) {
+        return which == RestartButton ? m_restartRect : which == HomeButton ? m_homeRect : QRect();
+    };
+    update(buttonRect(m_hovered) | buttonRect(button));
+    m_hovered = button;
+
+    if (button == NoButton) unsetCursor();
+    else setCursor(Qt::PointingHandCursor);
+}
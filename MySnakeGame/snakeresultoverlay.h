@@ -0,0 +1,111 @@
+#ifndef SNAKERESULTOVERLAY_H
+#define SNAKERESULTOVERLAY_H
+
+#include <QImage>
+#include <QRect>
+#include <QVariantAnimation>
+#include <QWidget>
+
+// Game Over / Win Panel Shown Over The Board, Built Once And Reused
+//
+// The panel is painted directly instead of being assembled from styled
+// labels and buttons: everything except the score and the hovered button is
+// rasterised into one cached image per kind while the game is idle (after the
+// overlay is created and again after the board is resized), so showing either
+// result is a text update and a blit rather than the first paint's work.
+// The fade-in is an opacity applied while painting rather than a widget
+// opacity effect, and the two buttons are hit-tested rectangles.
+class SnakeResultOverlay : public QWidget
+{
+    Q_OBJECT
+
+public:
+    enum Kind { GameOver, Win };
+
+    // Hidden Until showResult(); Follows The Parent's Size
+    explicit SnakeResultOverlay(QWidget *parent);
+
+    // Update The Text, Centre Over The Parent And Fade In
+    void showResult(Kind kind, int score);
+
+    // Change The Text Of The Visible Panel Without Restarting The Fade
+    void setResult(Kind kind, int score);
+
+    // Hide Immediately, Stopping Any Fade In Progress
+    void dismiss();
+
+    // Lay Out And Rasterise Any Stale Panels Now; Cheap When Both Are Current
+    void prepare();
+
+    Kind kind() const { return m_kind; }
+    int score() const { return m_score; }
+
+    // Fade Animation, For Registering With A SnakeActivityRegistry
+    QVariantAnimation *fadeAnimation() const { return m_fade; }
+
+signals:
+    // Buttons
+    void restartRequested();
+    void homeRequested();
+
+    // First Frame Painted After showResult()
+    void presented();
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void leaveEvent(QEvent *event) override;
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    // Button Under The Pointer
+    enum Button { NoButton, RestartButton, HomeButton };
+
+    // Size And Centre The Panel Over The Parent And Recompute Its Layout
+    void layoutInParent();
+
+    // Run prepare() Once The Event Loop Is Idle, Coalescing Repeated Requests
+    void schedulePrepare();
+
+    // Whether The Cached Panel Of kind Was Built For Another Size Or Pixel Ratio
+    bool panelStale(Kind kind) const;
+
+    // Rasterise The Unchanging Parts Of The Panel Of kind At The Current Size
+    void rebuildPanel(Kind kind);
+
+    // Draw A Rounded Button With Its Label In The Colours Of kind
+    void drawButton(QPainter &painter, const QRect &rect, Kind kind, Button button, bool hovered) const;
+
+    Button buttonAt(const QPoint &pos) const;
+    void setHovered(Button button);
+
+    Kind m_kind;
+    int m_score;
+    qreal m_opacity;                // Fade Progress Applied While Painting
+    bool m_presented;               // presented() Already Emitted For This Showing
+    bool m_prepareQueued;           // Idle prepare() Already Scheduled
+    Button m_hovered;
+    QVariantAnimation *m_fade;
+
+    // Layout In Widget Coordinates
+    QRect m_panelRect;
+    QRect m_titleRect;
+    QRect m_lineRect;
+    QRect m_scoreCardRect;
+    QRect m_restartRect;
+    QRect m_homeRect;
+
+    // Cached Panel Of One Kind And What It Was Built For
+    struct CachedPanel
+    {
+        QImage image;
+        QSize size;
+        qreal devicePixelRatio = 0;
+    };
+
+    // Indexed By Kind
+    CachedPanel m_panels[2];
+};
+
+#endif // SNAKERESULTOVERLAY_H
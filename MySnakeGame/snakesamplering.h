@@ -0,0 +1,78 @@
+#ifndef SNAKESAMPLERING_H
+#define SNAKESAMPLERING_H
+
+// Standard Library Only - Shared By The Widget And The Headless Tools
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Lock-Free Single Writer Ring Of Fixed Size Samples
+//
+// The writer never blocks or allocates: push() overwrites the oldest slot and
+// publishes the new total with a release store. Readers on any thread copy
+// the latest samples without locking and then re-read the total; anything
+// the writer may have overwritten during the copy is discarded, so a reader
+// only ever returns whole samples, at worst fewer than it asked for.
+template <typename T>
+class SnakeSampleRing
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Samples Are Copied Without Locks");
+
+public:
+    // capacity Is Rounded Up To A Power Of Two
+    explicit SnakeSampleRing(int capacity = 1024)
+    {
+        std::size_t size = 1;
+        while (size < static_cast<std::size_t>(std::max(1, capacity))) size <<= 1;
+        m_samples.resize(size);
+        m_mask = size - 1;
+    }
+
+    // Writer Only
+    void push(const T &sample)
+    {
+        std::uint64_t written = m_written.load(std::memory_order_relaxed);
+        m_samples[written & m_mask] = sample;
+        m_written.store(written + 1, std::memory_order_release);
+    }
+
+    // Writer Only, While No Reader Is Copying
+    void clear() { m_written.store(0, std::memory_order_release); }
+
+    int capacity() const { return static_cast<int>(m_samples.size()); }
+
+    // Samples Pushed Since Construction Or clear(), Including Overwritten Ones
+    std::uint64_t written() const { return m_written.load(std::memory_order_acquire); }
+
+    // Copy Up To count Of The Newest Samples Into out, Oldest First. Returns How Many Were Copied
+    int copyLatest(T *out, int count) const
+    {
+        std::uint64_t end = m_written.load(std::memory_order_acquire);
+        std::uint64_t wanted = std::min<std::uint64_t>({ static_cast<std::uint64_t>(std::max(0, count)),
+                                                         m_samples.size(), end });
+        std::uint64_t begin = end - wanted;
+        for (std::uint64_t i = begin; i < end; ++i) {
+            out[i - begin] = m_samples[i & m_mask];
+        }
+
+        // A Slot Is Unsafe Once The Writer Has Started The Push That Reuses It
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint64_t after = m_written.load(std::memory_order_relaxed);
+        std::uint64_t firstValid = after + 1 > m_samples.size() ? after + 1 - m_samples.size() : 0;
+        if (firstValid <= begin) return static_cast<int>(wanted);
+        if (firstValid >= end) return 0;
+
+        std::uint64_t skipped = firstValid - begin;
+        std::copy(out + skipped, out + wanted, out);
+        return static_cast<int>(wanted - skipped);
+    }
+
+private:
+    std::vector<T> m_samples;
+    std::size_t m_mask = 0;
+    std::atomic<std::uint64_t> m_written{0};
+};
+
+#endif // SNAKESAMPLERING_H
@@ -0,0 +1,181 @@
+#include "snakesprites.h"
+#include <QLinearGradient>
+#include <QRadialGradient>
+
+/**
+ * @brief Returns The Base Colour Of A Body Hue Variant
+ * @param variant Variant Index In [0, BodyVariants)
+ */
+QColor SnakeSpriteAtlas::bodyColor(int variant)
+{
+    int hue = (variant * 36) % 360;
+    return QColor::fromHsv(hue, 255, 200);
+}
+
+/**
+ * @brief Rasterises All Sprites Into A Single Transparent Atlas
+ * @param cellSize Logical Cell Size In Pixels
+ * @param devicePixelRatio Screen Scale Factor Of The Target Widget
+ */
+void SnakeSpriteAtlas::rebuild(int cellSize, qreal devicePixelRatio)
+{
+    m_cellSize = qMax(1, cellSize);
+    m_devicePixelRatio = devicePixelRatio;
+
+    m_atlas = QImage(QSize(m_cellSize * SlotCount, m_cellSize) * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    m_atlas.setDevicePixelRatio(devicePixelRatio);
+    m_atlas.fill(Qt::transparent);
+
+    QPainter painter(&m_atlas);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // Shape Bounds Inside A Cell Match The Original Per-Frame Drawing
+    int blockSize = m_cellSize - 2;
+    auto shapeRect = [&](int slot) {
+        return QRectF(slot * m_cellSize + 2, 2, blockSize - 4, blockSize - 4);
+    };
+
+    for (int variant = 0; variant < BodyVariants; ++variant) {
+        paintBody(painter, shapeRect(FirstBodySlot + variant), bodyColor(variant));
+    }
+
+    const SnakeDirection directions[] = {
+        SnakeDirection::Up, SnakeDirection::Down, SnakeDirection::Left, SnakeDirection::Right
+    };
+    for (SnakeDirection direction : directions) {
+        paintHead(painter, shapeRect(FirstHeadSlot + int(direction)), direction);
+    }
+
+    paintFood(painter, QRectF(FoodSlot * m_cellSize, 0, m_cellSize, m_cellSize));
+}
+
+/**
+ * @brief Blits A Body Segment
+ * @param painter Target Painter
+ * @param topLeft Top Left Corner Of The Segment's Cell
+ * @param variant Hue Variant, Wrapped Into Range
+ */
+void SnakeSpriteAtlas::drawBody(QPainter &painter, const QPointF &topLeft, int variant) const
+{
+    painter.drawImage(QRectF(topLeft, QSizeF(m_cellSize, m_cellSize)), m_atlas,
+                       sourceRect(FirstBodySlot + variant % BodyVariants));
+}
+
+/**
+ * @brief Blits The Head Facing A Direction
+ * @param painter Target Painter
+ * @param target Destination Rectangle, Larger Than A Cell While The Head Pulses
+ * @param direction Direction The Eyes Look
+ */
+void SnakeSpriteAtlas::drawHead(QPainter &painter, const QRectF &target, SnakeDirection direction) const
+{
+    painter.drawImage(target, m_atlas, sourceRect(FirstHeadSlot + int(direction)));
+}
+
+/**
+ * @brief Blits The Food Sprite
+ * @param painter Target Painter
+ * @param topLeft Top Left Corner Of The Food Cell
+ */
+void SnakeSpriteAtlas::drawFood(QPainter &painter, const QPointF &topLeft) const
+{
+    painter.drawImage(QRectF(topLeft, QSizeF(m_cellSize, m_cellSize)), m_atlas, sourceRect(FoodSlot));
+}
+
+/**
+ * @brief Source Rectangle Of A Slot, In Atlas Device Pixels
+ */
+QRectF SnakeSpriteAtlas::sourceRect(int slot) const
+{
+    qreal side = m_cellSize * m_devicePixelRatio;
+    return QRectF(slot * side, 0, side, side);
+}
+
+/**
+ * @brief Paints A Body Segment With Its Diagonal Gradient And Outline
+ */
+void SnakeSpriteAtlas::paintBody(QPainter &painter, const QRectF &rect, const QColor &color) const
+{
+    int cornerRadius = qBound(4, m_cellSize / 4, 12);
+
+    QLinearGradient bodyGradient(rect.topLeft(), rect.bottomRight());
+    bodyGradient.setColorAt(0, color.lighter(120));
+    bodyGradient.setColorAt(1, color.darker(120));
+
+    painter.setBrush(bodyGradient);
+    painter.setPen(QPen(QColor(255, 255, 255, 50), 1));
+    painter.drawRoundedRect(rect, cornerRadius - 2, cornerRadius - 2);
+}
+
+/**
+ * @brief Paints The Head With Radial Gradient And Eyes Facing A Direction
+ */
+void SnakeSpriteAtlas::paintHead(QPainter &painter, const QRectF &rect, SnakeDirection direction) const
+{
+    int cornerRadius = qBound(4, m_cellSize / 4, 12);
+
+    QRadialGradient headGradient(rect.center(), rect.width());
+    headGradient.setColorAt(0, Qt::red);
+    headGradient.setColorAt(0.7, QColor(200, 0, 0));
+    headGradient.setColorAt(1, QColor(150, 0, 0));
+
+    painter.setBrush(headGradient);
+    painter.setPen(Qt::NoPen);
+    painter.drawRoundedRect(rect, cornerRadius, cornerRadius);
+
+    // Draw Eyes Based On Direction (scaled with cell size)
+    painter.setBrush(Qt::white);
+    float eyeSize = rect.width() * 0.2;
+    float pupilSize = eyeSize * 0.5;
+
+    if (direction == SnakeDirection::Right) {
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2.5, rect.top() + eyeSize, eyeSize, eyeSize));
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2.5, rect.bottom() - eyeSize * 2, eyeSize, eyeSize));
+
+        painter.setBrush(Qt::black);
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2.5 + pupilSize/2, rect.top() + eyeSize + pupilSize/2, pupilSize, pupilSize));
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2.5 + pupilSize/2, rect.bottom() - eyeSize * 2 + pupilSize/2, pupilSize, pupilSize));
+    }
+    else if (direction == SnakeDirection::Left) {
+        painter.drawEllipse(QRectF(rect.left() + eyeSize * 1.5, rect.top() + eyeSize, eyeSize, eyeSize));
+        painter.drawEllipse(QRectF(rect.left() + eyeSize * 1.5, rect.bottom() - eyeSize * 2, eyeSize, eyeSize));
+
+        painter.setBrush(Qt::black);
+        painter.drawEllipse(QRectF(rect.left() + eyeSize * 1.5 + pupilSize/2, rect.top() + eyeSize + pupilSize/2, pupilSize, pupilSize));
+        painter.drawEllipse(QRectF(rect.left() + eyeSize * 1.5 + pupilSize/2, rect.bottom() - eyeSize * 2 + pupilSize/2, pupilSize, pupilSize));
+    }
+    else if (direction == SnakeDirection::Down) {
+        painter.drawEllipse(QRectF(rect.left() + eyeSize, rect.bottom() - eyeSize * 2.5, eyeSize, eyeSize));
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2, rect.bottom() - eyeSize * 2.5, eyeSize, eyeSize));
+
+        painter.setBrush(Qt::black);
+        painter.drawEllipse(QRectF(rect.left() + eyeSize + pupilSize/2, rect.bottom() - eyeSize * 2.5 + pupilSize/2, pupilSize, pupilSize));
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2 + pupilSize/2, rect.bottom() - eyeSize * 2.5 + pupilSize/2, pupilSize, pupilSize));
+    }
+    else {
+        painter.drawEllipse(QRectF(rect.left() + eyeSize, rect.top() + eyeSize * 1.5, eyeSize, eyeSize));
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2, rect.top() + eyeSize * 1.5, eyeSize, eyeSize));
+
+        painter.setBrush(Qt::black);
+        painter.drawEllipse(QRectF(rect.left() + eyeSize + pupilSize/2, rect.top() + eyeSize * 1.5 + pupilSize/2, pupilSize, pupilSize));
+        painter.drawEllipse(QRectF(rect.right() - eyeSize * 2 + pupilSize/2, rect.top() + eyeSize * 1.5 + pupilSize/2, pupilSize, pupilSize));
+    }
+}
+
+/**
+ * @brief Paints The Food Orb With Its Radial Gradient
+ * @param cell Full Cell Rectangle Of The Food Slot
+ */
+void SnakeSpriteAtlas::paintFood(QPainter &painter, const QRectF &cell) const
+{
+    int blockSize = m_cellSize - 2;
+
+    QRadialGradient foodGradient(cell.center(), m_cellSize * 0.8);
+    foodGradient.setColorAt(0, Qt::yellow);
+    foodGradient.setColorAt(0.7, QColor(255, 200, 0));
+    foodGradient.setColorAt(1, QColor(255, 100, 0));
+
+    painter.setBrush(foodGradient);
+    painter.setPen(Qt::NoPen);
+    painter.drawEllipse(QRectF(cell.x() + 2, cell.y() + 2, blockSize - 4, blockSize - 4));
+}
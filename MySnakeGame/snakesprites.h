@@ -0,0 +1,67 @@
+#ifndef SNAKESPRITES_H
+#define SNAKESPRITES_H
+
+#include <QImage>
+#include <QPainter>
+#include <QColor>
+#include <QRectF>
+#include "snaketypes.h"
+
+// Pre-Rendered Sprite Atlas For Snake Segments, Heads And Food
+//
+// Gradients, rounded rects and eyes are rasterised once per cell size and
+// device pixel ratio; each frame then only blits sub-rects with drawImage.
+// The atlas is a premultiplied QImage rather than a QPixmap so renderers
+// can run on worker threads; on the raster engine the blit cost is the same.
+class SnakeSpriteAtlas
+{
+public:
+    // Number Of Hue Variants Cycled Along The Body
+    static const int BodyVariants = 10;
+
+    // Check Whether The Atlas Was Built For This Cell Size And Screen
+    bool matches(int cellSize, qreal devicePixelRatio) const
+    {
+        return !m_atlas.isNull() && m_cellSize == cellSize && m_devicePixelRatio == devicePixelRatio;
+    }
+
+    // Rasterise Every Sprite For A Cell Size And Device Pixel Ratio
+    void rebuild(int cellSize, qreal devicePixelRatio);
+
+    // Blit A Body Segment Whose Cell Starts At topLeft
+    void drawBody(QPainter &painter, const QPointF &topLeft, int variant) const;
+
+    // Blit The Head Scaled Into target (one cell at scale 1.0)
+    void drawHead(QPainter &painter, const QRectF &target, SnakeDirection direction) const;
+
+    // Blit Food Whose Cell Starts At topLeft
+    void drawFood(QPainter &painter, const QPointF &topLeft) const;
+
+    // Base Body Colour For A Hue Variant
+    static QColor bodyColor(int variant);
+
+    int cellSize() const { return m_cellSize; }
+
+private:
+    // Atlas Slots, One Cell Each, Laid Out In A Single Row
+    enum Slot {
+        FirstBodySlot = 0,
+        FirstHeadSlot = BodyVariants,
+        FoodSlot = BodyVariants + 4,
+        SlotCount
+    };
+
+    // Source Rectangle Of A Slot In Atlas Pixels
+    QRectF sourceRect(int slot) const;
+
+    // Sprite Painters, rect Is The Shape Bounds Inside The Slot In Logical Pixels
+    void paintBody(QPainter &painter, const QRectF &rect, const QColor &color) const;
+    void paintHead(QPainter &painter, const QRectF &rect, SnakeDirection direction) const;
+    void paintFood(QPainter &painter, const QRectF &cell) const;
+
+    QImage m_atlas;                     // All Sprites Side By Side
+    int m_cellSize = 0;                 // Cell Size The Atlas Was Built For
+    qreal m_devicePixelRatio = 0;       // Screen Scale The Atlas Was Built For
+};
+
+#endif // SNAKESPRITES_H
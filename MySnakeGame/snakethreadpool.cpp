@@ -0,0 +1,130 @@
+#include "snakethreadpool.h"
+#include <algorithm>
+#include <thread>
+
+/**
+ * @brief Constructor, Starting The Pool Threads
+ * @param threadCount Worker Count, 0 Selects std::thread::hardware_concurrency()
+ */
+SnakeThreadPool::SnakeThreadPool(int threadCount)
+    : m_threadCount(threadCount > 0 ? threadCount
+                                    : std::max(1, static_cast<int>(std::thread::hardware_concurrency())))
+    , m_queues(m_threadCount)
+{
+    m_threads.reserve(m_threadCount - 1);
+    for (int worker = 1; worker < m_threadCount; ++worker) {
+        m_threads.emplace_back(&SnakeThreadPool::workerLoop, this, worker);
+    }
+}
+
+/**
+ * @brief Wakes The Pool Threads To Exit And Joins Them
+ */
+SnakeThreadPool::~SnakeThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_batchMutex);
+        m_stopping = true;
+    }
+    m_batchPosted.notify_all();
+    for (std::thread &thread : m_threads) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Runs A Batch Of Tasks On All Workers, The Calling Thread Being Worker 0
+ * @param taskCount Number Of Tasks
+ * @param task Callback Receiving The Task Index And The Worker Running It
+ */
+void SnakeThreadPool::run(int taskCount, const std::function<void(int index, int worker)> &task)
+{
+    // Worker w Owns [w * taskCount / threads, (w + 1) * taskCount / threads)
+    for (int worker = 0; worker < m_threadCount; ++worker) {
+        int first = static_cast<int>(static_cast<long long>(taskCount) * worker / m_threadCount);
+        int last = static_cast<int>(static_cast<long long>(taskCount) * (worker + 1) / m_threadCount);
+        for (int index = first; index < last; ++index) {
+            m_queues[worker].tasks.push_back(index);
+        }
+    }
+
+    if (m_threads.empty()) {
+        drain(0, task);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_batchMutex);
+        m_task = &task;
+        m_busy = static_cast<int>(m_threads.size());
+        ++m_batch;
+    }
+    m_batchPosted.notify_all();
+
+    drain(0, task);
+
+    std::unique_lock<std::mutex> lock(m_batchMutex);
+    m_batchDone.wait(lock, [this] { return m_busy == 0; });
+    m_task = nullptr;
+}
+
+/**
+ * @brief Pool Thread Body: One drain() Per Posted Batch
+ */
+void SnakeThreadPool::workerLoop(int worker)
+{
+    std::uint64_t seen = 0;
+    for (;;) {
+        const std::function<void(int index, int worker)> *task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_batchMutex);
+            m_batchPosted.wait(lock, [this, seen] { return m_stopping || m_batch != seen; });
+            if (m_stopping) return;
+            seen = m_batch;
+            task = m_task;
+        }
+
+        drain(worker, *task);
+
+        std::lock_guard<std::mutex> lock(m_batchMutex);
+        if (--m_busy == 0) m_batchDone.notify_one();
+    }
+}
+
+/**
+ * @brief Runs Own And Stolen Tasks Until None Are Left
+ */
+void SnakeThreadPool::drain(int worker, const std::function<void(int index, int worker)> &task)
+{
+    int index = 0;
+    while (nextTask(worker, index)) {
+        task(index, worker);
+    }
+}
+
+/**
+ * @brief Pops Local Work In Ascending Order, Otherwise Steals The Highest Index Of The Next Non-Empty Queue
+ */
+bool SnakeThreadPool::nextTask(int worker, int &index)
+{
+    {
+        WorkQueue &own = m_queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            index = own.tasks.front();
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+
+    for (int offset = 1; offset < m_threadCount; ++offset) {
+        WorkQueue &victim = m_queues[(worker + offset) % m_threadCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            index = victim.tasks.back();
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
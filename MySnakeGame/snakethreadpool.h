@@ -0,0 +1,72 @@
+#ifndef SNAKETHREADPOOL_H
+#define SNAKETHREADPOOL_H
+
+// Standard Library Only - Shared By The Headless Tools
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work Stealing Pool For Batches Of Independent Tasks
+//
+// run() deals each worker a contiguous range of task indices. A worker takes
+// its own tasks in ascending order from the front of its deque and, once that
+// is empty, steals from the back of the others, so uneven task lengths (a long
+// game next to a short one) still keep every core busy until the batch is
+// done. Consecutive indices stay on one worker unless they are stolen, which
+// lets tasks reuse per-worker state built for the previous index.
+//
+// The worker threads are started once and sleep between batches, so callers
+// running a small batch every tick (an autopilot) pay a wake-up, not a thread
+// creation, per run(). run() must not be called concurrently on one pool.
+class SnakeThreadPool
+{
+public:
+    // Use threadCount Workers, 0 Means One Per Hardware Thread
+    explicit SnakeThreadPool(int threadCount = 0);
+    ~SnakeThreadPool();
+
+    SnakeThreadPool(const SnakeThreadPool &) = delete;
+    SnakeThreadPool &operator=(const SnakeThreadPool &) = delete;
+
+    int threadCount() const { return m_threadCount; }
+
+    // Run task(index, worker) For Every index In [0, taskCount), Blocking Until All Finish.
+    // worker Is In [0, threadCount()) And Identifies Per-Thread Scratch State.
+    void run(int taskCount, const std::function<void(int index, int worker)> &task);
+
+private:
+    // One Worker's Queue Of Pending Task Indices
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<int> tasks;
+    };
+
+    // Sleep Until A Batch Is Posted, Work Through It, Repeat Until Destruction
+    void workerLoop(int worker);
+
+    // Run Tasks Until Every Queue Is Empty
+    void drain(int worker, const std::function<void(int index, int worker)> &task);
+
+    // Take The Next Task From The Worker's Own Queue, Else Steal One, Returns false When All Are Empty
+    bool nextTask(int worker, int &index);
+
+    int m_threadCount;
+    std::vector<WorkQueue> m_queues;
+    std::vector<std::thread> m_threads;     // Workers 1 .. threadCount - 1; The Caller Is Worker 0
+
+    // Batch Hand-Off
+    std::mutex m_batchMutex;
+    std::condition_variable m_batchPosted;
+    std::condition_variable m_batchDone;
+    const std::function<void(int index, int worker)> *m_task = nullptr;
+    std::uint64_t m_batch = 0;              // Incremented For Every Posted Batch
+    int m_busy = 0;                         // Pool Threads Still Working On The Current Batch
+    bool m_stopping = false;
+};
+
+#endif // SNAKETHREADPOOL_H
@@ -0,0 +1,145 @@
+#include "snaketickscheduler.h"
+#include <algorithm>
+
+namespace {
+
+// Lateness Buckets Of 0.25 ms Up To 32 ms, Interval Buckets Of 0.5 ms Up To 512 ms
+const std::int64_t LatenessBucketNs = 250000;
+const int LatenessBuckets = 128;
+const std::int64_t IntervalBucketNs = 500000;
+const int IntervalBuckets = 1024;
+
+}
+
+/**
+ * @brief Constructor
+ * @param maxCatchUp Most Ticks Run Back To Back After A Stall
+ */
+SnakeTickScheduler::SnakeTickScheduler(int maxCatchUp)
+    : m_maxCatchUp(std::max(1, maxCatchUp))
+    , m_paused(false)
+    , m_intervalNs(1)
+    , m_nextDeadlineNs(0)
+    , m_pausedRemainingNs(0)
+    , m_lastTickNs(-1)
+    , m_runStartNs(0)
+    , m_runningNs(0)
+    , m_lateness(LatenessBucketNs, LatenessBuckets)
+    , m_intervals(IntervalBucketNs, IntervalBuckets)
+    , m_ticks(0)
+    , m_lateTicks(0)
+    , m_droppedTicks(0)
+{
+}
+
+/**
+ * @brief Starts A New Schedule And Clears The Statistics
+ * @param nowNs Current Clock Reading
+ * @param intervalNs Time Between Ticks
+ */
+void SnakeTickScheduler::start(std::int64_t nowNs, std::int64_t intervalNs)
+{
+    m_intervalNs = std::max<std::int64_t>(1, intervalNs);
+    m_nextDeadlineNs = nowNs + m_intervalNs;
+    m_paused = false;
+    m_pausedRemainingNs = 0;
+    m_lastTickNs = -1;
+    m_runStartNs = nowNs;
+    m_runningNs = 0;
+
+    m_lateness.clear();
+    m_intervals.clear();
+    m_ticks = 0;
+    m_lateTicks = 0;
+    m_droppedTicks = 0;
+}
+
+/**
+ * @brief Changes The Tick Interval Without Losing Partial Progress
+ *
+ * The fraction of the current tick already elapsed is kept, so changing speed
+ * mid-game neither stutters nor fires an early tick.
+ */
+void SnakeTickScheduler::setInterval(std::int64_t nowNs, std::int64_t intervalNs)
+{
+    intervalNs = std::max<std::int64_t>(1, intervalNs);
+    if (intervalNs == m_intervalNs) return;
+
+    std::int64_t remainingNs = m_paused ? m_pausedRemainingNs : std::max<std::int64_t>(0, m_nextDeadlineNs - nowNs);
+    remainingNs = static_cast<std::int64_t>(double(remainingNs) * intervalNs / m_intervalNs);
+    m_intervalNs = intervalNs;
+    m_lastTickNs = -1;
+
+    if (m_paused) m_pausedRemainingNs = remainingNs;
+    else m_nextDeadlineNs = nowNs + remainingNs;
+}
+
+/**
+ * @brief Freezes The Schedule
+ */
+void SnakeTickScheduler::pause(std::int64_t nowNs)
+{
+    if (m_paused) return;
+    m_paused = true;
+    m_pausedRemainingNs = std::clamp<std::int64_t>(m_nextDeadlineNs - nowNs, 0, m_intervalNs);
+    m_runningNs += nowNs - m_runStartNs;
+}
+
+/**
+ * @brief Resumes The Schedule Where pause() Left It
+ */
+void SnakeTickScheduler::resume(std::int64_t nowNs)
+{
+    if (!m_paused) return;
+    m_paused = false;
+    m_nextDeadlineNs = nowNs + m_pausedRemainingNs;
+    m_lastTickNs = -1;
+    m_runStartNs = nowNs;
+}
+
+/**
+ * @brief Claims Every Tick Whose Deadline Has Passed
+ * @param nowNs Current Clock Reading
+ */
+SnakeTickFrame SnakeTickScheduler::advance(std::int64_t nowNs)
+{
+    SnakeTickFrame frame;
+    if (m_paused) {
+        frame.progress = 1.0 - double(m_pausedRemainingNs) / m_intervalNs;
+        return frame;
+    }
+
+    if (nowNs >= m_nextDeadlineNs) {
+        std::int64_t due = (nowNs - m_nextDeadlineNs) / m_intervalNs + 1;
+        frame.ticks = static_cast<int>(std::min<std::int64_t>(due, m_maxCatchUp));
+        frame.late = frame.ticks - 1;
+        frame.dropped = static_cast<int>(due - frame.ticks);
+
+        // Lateness Of Each Tick That Runs, Measured Against Its Own Deadline
+        for (int i = 0; i < frame.ticks; ++i) {
+            m_lateness.record(nowNs - (m_nextDeadlineNs + i * m_intervalNs));
+        }
+        if (m_lastTickNs >= 0) {
+            m_intervals.record(nowNs - m_lastTickNs);
+        }
+        m_lastTickNs = nowNs;
+
+        // Dropped Ticks Are Skipped On The Same Grid, So The Phase Is Preserved
+        m_nextDeadlineNs += due * m_intervalNs;
+        m_ticks += static_cast<std::uint64_t>(frame.ticks);
+        m_lateTicks += static_cast<std::uint64_t>(frame.late);
+        m_droppedTicks += static_cast<std::uint64_t>(frame.dropped);
+    }
+
+    frame.progress = 1.0 - double(m_nextDeadlineNs - nowNs) / m_intervalNs;
+    return frame;
+}
+
+/**
+ * @brief Ticks Per Second Actually Run While Unpaused (Dropped Ticks Lower It)
+ */
+double SnakeTickScheduler::tickRate(std::int64_t nowNs) const
+{
+    std::int64_t runningNs = m_runningNs + (m_paused ? 0 : nowNs - m_runStartNs);
+    return runningNs > 0 ? double(m_ticks) * 1e9 / runningNs : 0.0;
+}
@@ -0,0 +1,79 @@
+#ifndef SNAKETICKSCHEDULER_H
+#define SNAKETICKSCHEDULER_H
+
+// Standard Library Only - Takes Clock Readings From The Caller So It Can Be Driven
+// By QElapsedTimer In The Widget And By A Simulated Clock In The Benchmarks
+#include "snakehistogram.h"
+#include <cstdint>
+
+// Ticks Due In One Frame, As Returned By SnakeTickScheduler::advance()
+struct SnakeTickFrame
+{
+    int ticks = 0;                  // Ticks To Run Now
+    int late = 0;                   // Of Those, Ticks Owed By An Earlier Frame
+    int dropped = 0;                // Ticks Skipped Because The Frame Fell Too Far Behind
+    double progress = 0.0;          // Fraction Of The Next Tick Already Elapsed
+};
+
+// Drift Free Fixed Rate Tick Scheduler
+//
+// Tick n is due at anchor + n * interval on the caller's monotonic clock, so
+// rounding in the render timer or a slow frame shifts when a tick runs but
+// never the schedule itself: over any span the tick count matches elapsed
+// time exactly. After a stall up to maxCatchUp ticks run back to back; any
+// more are dropped and the schedule re-anchors on the next due deadline.
+//
+// Every tick records its lateness against its deadline, and every pair of
+// consecutive ticks the real interval between them, in histograms that can
+// be read at any time.
+class SnakeTickScheduler
+{
+public:
+    explicit SnakeTickScheduler(int maxCatchUp = 4);
+
+    // Start A Fresh Schedule With The First Tick One Interval After nowNs; Clears Statistics
+    void start(std::int64_t nowNs, std::int64_t intervalNs);
+
+    // Change The Interval, Keeping The Progress Already Made Towards The Next Tick
+    void setInterval(std::int64_t nowNs, std::int64_t intervalNs);
+
+    // Freeze And Resume The Schedule; Time Spent Paused Counts Towards Nothing
+    void pause(std::int64_t nowNs);
+    void resume(std::int64_t nowNs);
+    bool isPaused() const { return m_paused; }
+
+    // Claim The Ticks Due At nowNs
+    SnakeTickFrame advance(std::int64_t nowNs);
+
+    // Deadline Of The Next Tick, Used To Arm The Wake-Up Timer
+    std::int64_t nextDeadlineNs() const { return m_nextDeadlineNs; }
+    std::int64_t intervalNs() const { return m_intervalNs; }
+
+    // Statistics Since start()
+    const SnakeHistogram &lateness() const { return m_lateness; }
+    const SnakeHistogram &intervals() const { return m_intervals; }
+    std::uint64_t tickCount() const { return m_ticks; }
+    std::uint64_t lateTicks() const { return m_lateTicks; }
+    std::uint64_t droppedTicks() const { return m_droppedTicks; }
+
+    // Ticks Per Second Actually Run Over Unpaused Time, Compare With 1e9 / intervalNs()
+    double tickRate(std::int64_t nowNs) const;
+
+private:
+    int m_maxCatchUp;
+    bool m_paused;
+    std::int64_t m_intervalNs;
+    std::int64_t m_nextDeadlineNs;
+    std::int64_t m_pausedRemainingNs;       // Time Left To The Next Tick When Paused
+    std::int64_t m_lastTickNs;              // Clock Reading Of The Previous Tick, -1 After A Gap
+    std::int64_t m_runStartNs;              // Start Of The Current Unpaused Stretch
+    std::int64_t m_runningNs;               // Unpaused Time Before m_runStartNs
+
+    SnakeHistogram m_lateness;
+    SnakeHistogram m_intervals;
+    std::uint64_t m_ticks;
+    std::uint64_t m_lateTicks;
+    std::uint64_t m_droppedTicks;
+};
+
+#endif // SNAKETICKSCHEDULER_H
@@ -0,0 +1,60 @@
+#ifndef SNAKETYPES_H
+#define SNAKETYPES_H
+
+// Plain Value Types Shared By The Snake Engine, Its Tools And The Widget
+#include <cstdint>
+
+// Grid Cell Coordinate Used By The Engine
+struct SnakeCell {
+    int x;
+    int y;
+};
+
+inline bool operator==(const SnakeCell &a, const SnakeCell &b) { return a.x == b.x && a.y == b.y; }
+inline bool operator!=(const SnakeCell &a, const SnakeCell &b) { return !(a == b); }
+
+// Movement Direction Requested By The Player Or An AI Policy
+enum class SnakeDirection : std::uint8_t {
+    Up,
+    Down,
+    Left,
+    Right
+};
+
+// Outcome Of A Single Engine Tick
+enum class SnakeStepResult : std::uint8_t {
+    Moved,      // Snake Advanced Without Eating
+    Ate,        // Snake Ate Food And Grew By One Segment
+    Won,        // Snake Filled The Whole Grid
+    HitWall,    // Head Left The Grid
+    HitSelf,    // Head Ran Into The Body
+    HitSnake,   // Head Ran Into Another Snake (Arena Only)
+    HeadOn,     // Lost A Head-On Contest For A Cell (Arena Only)
+    Finished    // Game Was Already Over Before This Tick
+};
+
+// Return Grid Offset For A Direction
+inline SnakeCell directionDelta(SnakeDirection direction)
+{
+    switch (direction) {
+    case SnakeDirection::Up:    return SnakeCell{0, -1};
+    case SnakeDirection::Down:  return SnakeCell{0, 1};
+    case SnakeDirection::Left:  return SnakeCell{-1, 0};
+    case SnakeDirection::Right: return SnakeCell{1, 0};
+    }
+    return SnakeCell{0, 0};
+}
+
+// Return The Direction Pointing The Opposite Way
+inline SnakeDirection oppositeDirection(SnakeDirection direction)
+{
+    switch (direction) {
+    case SnakeDirection::Up:    return SnakeDirection::Down;
+    case SnakeDirection::Down:  return SnakeDirection::Up;
+    case SnakeDirection::Left:  return SnakeDirection::Right;
+    case SnakeDirection::Right: return SnakeDirection::Left;
+    }
+    return direction;
+}
+
+#endif // SNAKETYPES_H
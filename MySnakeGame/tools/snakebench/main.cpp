@@ -0,0 +1,856 @@
+#include "snakearena.h"
+#include "snakeautopilot.h"
+#include "snakebatchenv.h"
+#include "snakeengine.h"
+#include "snakeinputqueue.h"
+#include "snakemapfields.h"
+#include "snakemcts.h"
+#include "snakereplay.h"
+#include "snakethreadpool.h"
+#include "snaketickscheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Direction Along A Fixed Hamiltonian Cycle Of An Even Sized Grid
+ *
+ * Column 0 is the return lane, the remaining columns are swept row by row
+ * in a serpentine, so following it never collides and eventually fills the grid.
+ */
+SnakeDirection cycleDirection(SnakeCell cell, int gridSize)
+{
+    if (cell.x == 0) {
+        return cell.y == 0 ? SnakeDirection::Right : SnakeDirection::Up;
+    }
+    if (cell.y % 2 == 0) {
+        return cell.x < gridSize - 1 ? SnakeDirection::Right : SnakeDirection::Down;
+    }
+    if (cell.x > 1 || cell.y == gridSize - 1) {
+        return SnakeDirection::Left;
+    }
+    return SnakeDirection::Down;
+}
+
+/**
+ * @brief Policy That Follows The Cycle, Stepping Onto It When The Start Position Is Reversed
+ */
+SnakeDirection cyclePolicy(const SnakeEngine &engine)
+{
+    SnakeDirection wanted = cycleDirection(engine.head(), engine.gridSize());
+    if (wanted == oppositeDirection(engine.direction())) {
+        return SnakeDirection::Down;
+    }
+    return wanted;
+}
+
+/**
+ * @brief Runs The Engine For A Fixed Number Of Ticks, Restarting Finished Games
+ */
+void benchTicks(int gridSize, long long ticks)
+{
+    SnakeEngine engine(gridSize, 12345);
+    long long games = 0;
+    long long totalLength = 0;
+
+    Clock::time_point start = Clock::now();
+    for (long long i = 0; i < ticks; ++i) {
+        engine.step(cyclePolicy(engine));
+        if (engine.isGameOver()) {
+            totalLength += engine.length();
+            ++games;
+            engine.reset();
+        }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("grid %4dx%-4d  %12lld ticks  %8.3f s  %14.0f ticks/s  %6lld games  avg length %.1f\n",
+                gridSize, gridSize, ticks, seconds, ticks / seconds, games,
+                games > 0 ? double(totalLength) / games : double(engine.length()));
+}
+
+/**
+ * @brief Lays A Snake Of The Given Length Along The Cycle, Head First
+ */
+std::vector<SnakeCell> cycleBody(int gridSize, int length, SnakeDirection &direction)
+{
+    std::vector<SnakeCell> path;
+    path.reserve(length);
+    SnakeCell cell{0, 0};
+    for (int i = 0; i < length; ++i) {
+        path.push_back(cell);
+        direction = cycleDirection(cell, gridSize);
+        SnakeCell delta = directionDelta(direction);
+        cell = SnakeCell{cell.x + delta.x, cell.y + delta.y};
+    }
+
+    // Direction Of Travel Is The Step Taken Into The Head Cell
+    direction = cycleDirection(path.size() > 1 ? path[path.size() - 2] : path.back(), gridSize);
+    return std::vector<SnakeCell>(path.rbegin(), path.rend());
+}
+
+/**
+ * @brief Measures Tick Cost At Increasing Snake Lengths On One Grid
+ *
+ * With O(1) collision and occupancy checks the cost per tick should stay
+ * flat whether the snake covers a handful of cells or nearly the whole grid.
+ */
+void benchScaling(int gridSize, long long ticks, double maxFill = 1.0)
+{
+    long long cells = static_cast<long long>(gridSize) * gridSize;
+    SnakeEngine engine(gridSize, 12345);
+
+    for (double fill : {0.0, 0.01, 0.10, 0.50, 0.90}) {
+        if (fill > maxFill) break;
+        int length = static_cast<int>(std::max<long long>(3, static_cast<long long>(cells * fill)));
+        SnakeDirection direction = SnakeDirection::Right;
+        std::vector<SnakeCell> body = cycleBody(gridSize, length, direction);
+        engine.loadBody(body, direction);
+
+        Clock::time_point start = Clock::now();
+        for (long long i = 0; i < ticks; ++i) {
+            engine.step(cycleDirection(engine.head(), gridSize));
+            if (engine.isGameOver()) {
+                engine.loadBody(body, direction);
+            }
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::printf("grid %4dx%-4d  length %8d (%3.0f%%)  %10.1f ns/tick\n",
+                    gridSize, gridSize, length, fill * 100.0, seconds * 1e9 / ticks);
+    }
+}
+
+/**
+ * @brief Rooms Of room x room Cells Split By Two Cell Thick Walls, Each Wall Span Holding A Two Cell Door
+ *
+ * Walls and doors sit on even coordinates, so every 2x2 block is all wall or
+ * all free and the map has a block Hamiltonian cycle.
+ */
+SnakeMap roomMap(int gridSize, int room, std::uint64_t seed)
+{
+    SnakeMap map(gridSize);
+    SnakeRandom rng(seed);
+    for (int line = room; line + 1 < gridSize; line += room) {
+        for (int i = 0; i < gridSize; ++i) {
+            for (int t = 0; t < 2; ++t) {
+                map.setWall(SnakeCell{line + t, i}, true);
+                map.setWall(SnakeCell{i, line + t}, true);
+            }
+        }
+    }
+    for (int line = room; line + 1 < gridSize; line += room) {
+        for (int span = 0; span < gridSize; span += room) {
+            // Doors Open Into The Room Interior, Past The Crossing Wall At span
+            int width = std::min(room, gridSize - span) - 2;
+            if (width < 2) continue;
+            int door = span + 2 * static_cast<int>(rng.bounded(static_cast<std::uint32_t>(width / 2)));
+            if (span > 0) door = std::min(door + 2, span + width);
+            for (int t = 0; t < 2; ++t) {
+                for (int d = 0; d < 2; ++d) {
+                    map.setWall(SnakeCell{line + t, door + d}, false);
+                    map.setWall(SnakeCell{door + d, line + t}, false);
+                }
+            }
+        }
+    }
+    map.setSpawn(SnakeCell{room / 2, room / 2}, SnakeDirection::Right);
+    return map;
+}
+
+/**
+ * @brief Plays Whole Games With Each Autopilot Strategy
+ *
+ * Only time spent inside decide() is counted toward decisions per second.
+ * A game that goes gridSize^2 * 4 ticks without eating is stopped as stalled.
+ * Returns how often A* died; its tail check should make that impossible.
+ */
+int benchAutopilot(int gridSize, int games, std::shared_ptr<const SnakeMap> map = nullptr)
+{
+    const SnakeAutopilotKind kinds[] = {
+        SnakeAutopilotKind::GreedyBfs, SnakeAutopilotKind::AStar, SnakeAutopilotKind::Hamiltonian
+    };
+    const long long stallLimit = 4LL * gridSize * gridSize;
+
+    int aStarDeaths = 0;
+    for (SnakeAutopilotKind kind : kinds) {
+        std::unique_ptr<SnakeStrategy> strategy = createSnakeStrategy(kind);
+        long long decisions = 0;
+        long long totalLength = 0;
+        int wins = 0;
+        int stalls = 0;
+        int deaths = 0;
+        double decideSeconds = 0;
+        double worstDecision = 0;
+
+        for (int game = 0; game < games; ++game) {
+            SnakeEngine engine(gridSize, 1000 + game);
+            if (map) engine.setMap(map);
+            long long sinceFood = 0;
+            while (!engine.isGameOver()) {
+                Clock::time_point start = Clock::now();
+                SnakeDirection direction = strategy->decide(engine);
+                double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+                decideSeconds += elapsed;
+                worstDecision = std::max(worstDecision, elapsed);
+                ++decisions;
+
+                SnakeStepResult result = engine.step(direction);
+                sinceFood = result == SnakeStepResult::Ate ? 0 : sinceFood + 1;
+                if (sinceFood > stallLimit) {
+                    ++stalls;
+                    break;
+                }
+            }
+            totalLength += engine.length();
+            wins += engine.hasWon() ? 1 : 0;
+            deaths += engine.isGameOver() && !engine.hasWon() ? 1 : 0;
+        }
+        if (kind == SnakeAutopilotKind::AStar) aStarDeaths = deaths;
+
+        std::printf("grid %4dx%-4d%s  %-12s  %12.0f decisions/s  worst %8.1f us  avg final length %7.1f  "
+                    "wins %3d/%d  stalls %d  deaths %d\n",
+                    gridSize, gridSize, map ? "  walled" : "", strategy->name(), decisions / decideSeconds,
+                    worstDecision * 1e6, double(totalLength) / games, wins, games, stalls, deaths);
+    }
+    return aStarDeaths;
+}
+
+/**
+ * @brief Records Autopilot Games, Round-Trips Them Through The File Format And Replays Them
+ *
+ * Each playback must end in exactly the recorded state (tick, score, length,
+ * head and food); speed is reported against the 150 ms medium difficulty tick.
+ */
+void benchReplay(int gridSize, int games)
+{
+    std::unique_ptr<SnakeStrategy> strategy = createSnakeStrategy(SnakeAutopilotKind::AStar);
+    const long long tickLimit = 16LL * gridSize * gridSize * gridSize;
+
+    long long totalTicks = 0;
+    long long totalInputs = 0;
+    long long totalBytes = 0;
+    double replaySeconds = 0;
+    int mismatches = 0;
+
+    for (int game = 0; game < games; ++game) {
+        SnakeEngine engine(gridSize);
+        engine.reset(gridSize, 7000 + game);
+
+        SnakeReplayRecorder recorder;
+        recorder.begin(engine.seed(), 1, gridSize);
+        while (!engine.isGameOver() && engine.tickCount() < static_cast<std::uint64_t>(tickLimit)) {
+            SnakeDirection direction = strategy->decide(engine);
+            recorder.record(engine.tickCount() + 1, direction);
+            engine.step(direction);
+        }
+        recorder.finish(engine);
+
+        std::vector<std::uint8_t> file = recorder.replay().serialize();
+        SnakeReplay loaded;
+        if (!SnakeReplay::deserialize(file.data(), file.size(), loaded)) {
+            ++mismatches;
+            continue;
+        }
+
+        SnakeEngine playback(gridSize);
+        SnakeReplayPlayer player(loaded);
+        Clock::time_point start = Clock::now();
+        player.start(playback);
+        bool matched = player.playToEnd(playback);
+        replaySeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+        matched = matched && playback.length() == engine.length() && playback.head() == engine.head()
+                  && playback.food() == engine.food() && playback.isGameOver() == engine.isGameOver();
+        mismatches += matched ? 0 : 1;
+
+        totalTicks += static_cast<long long>(engine.tickCount());
+        totalInputs += loaded.inputCount;
+        totalBytes += static_cast<long long>(file.size());
+    }
+
+    double ticksPerSecond = totalTicks / replaySeconds;
+    std::printf("grid %4dx%-4d  %3d games  %9lld ticks  %7lld turns  %8lld bytes (%.2f bytes/turn)  "
+                "%12.0f replay ticks/s (%.0fx real time)  mismatches %d\n",
+                gridSize, gridSize, games, totalTicks, totalInputs, totalBytes,
+                totalInputs > 0 ? double(totalBytes) / totalInputs : 0.0,
+                ticksPerSecond, ticksPerSecond * 0.150, mismatches);
+}
+
+/**
+ * @brief Steps A Lockstep Batch Of Games With Random Actions
+ *
+ * Actions come from a small pre-generated table so only BatchSnakeEnv::step()
+ * is timed; observations are written once per step when requested.
+ */
+void benchBatch(int envCount, int gridSize, long long steps, bool observe)
+{
+    BatchSnakeEnv env(envCount, gridSize, 42);
+    const int actionSets = 64;
+    std::vector<std::uint8_t> actions(static_cast<size_t>(actionSets) * envCount);
+    SnakeRandom rng(7);
+    for (std::uint8_t &action : actions) {
+        action = static_cast<std::uint8_t>(rng.bounded(4));
+    }
+    std::vector<float> rewards(envCount);
+    std::vector<std::uint8_t> dones(envCount);
+    std::vector<float> observations(observe ? static_cast<size_t>(envCount) * env.observationSize() : 0);
+
+    Clock::time_point start = Clock::now();
+    for (long long i = 0; i < steps; ++i) {
+        env.step(&actions[static_cast<size_t>(i % actionSets) * envCount], rewards.data(), dones.data());
+        if (observe) env.writeObservations(observations.data());
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("grid %4dx%-4d  %6d envs  %8lld steps  %s  %14.0f env-steps/s  %10llu episodes\n",
+                gridSize, gridSize, envCount, steps, observe ? "with observations" : "step only        ",
+                envCount * double(steps) / seconds, static_cast<unsigned long long>(env.episodeCount()));
+}
+
+/**
+ * @brief Plays The Same Random Actions Through BatchSnakeEnv And One SnakeEngine Per Game
+ *
+ * Game i of the batch and an engine seeded with seed + i must agree after
+ * every step on the reward, the done flag, head, direction, length, score,
+ * food and every blocked cell, including across automatic resets.
+ * Returns how many games diverged.
+ */
+int checkBatch(int envCount, int gridSize, long long steps, std::shared_ptr<const SnakeMap> map = nullptr)
+{
+    const std::uint64_t seed = 42;
+    BatchSnakeEnv env(envCount, gridSize, seed, map);
+    std::vector<SnakeEngine> engines;
+    engines.reserve(envCount);
+    for (int i = 0; i < envCount; ++i) {
+        engines.emplace_back(env.gridSize(), seed + i);
+        if (env.map()) {
+            engines.back().setMap(map);
+            engines.back().reset(env.gridSize(), seed + i);
+        }
+    }
+
+    SnakeRandom rng(7);
+    std::vector<std::uint8_t> actions(envCount);
+    std::vector<float> rewards(envCount);
+    std::vector<std::uint8_t> dones(envCount);
+    std::vector<bool> diverged(envCount, false);
+    for (long long step = 0; step < steps; ++step) {
+        for (std::uint8_t &action : actions) {
+            action = static_cast<std::uint8_t>(rng.bounded(4));
+        }
+        env.step(actions.data(), rewards.data(), dones.data());
+
+        for (int i = 0; i < envCount; ++i) {
+            SnakeEngine &engine = engines[i];
+            SnakeStepResult result = engine.step(static_cast<SnakeDirection>(actions[i]));
+            bool done = engine.isGameOver();
+            float reward = result == SnakeStepResult::Ate || result == SnakeStepResult::Won
+                               ? BatchSnakeEnv::FoodReward
+                               : done ? BatchSnakeEnv::DeathReward : BatchSnakeEnv::StepReward;
+            if (done) engine.reset();
+
+            bool same = done == (dones[i] != 0) && reward == rewards[i] && engine.head() == env.head(i)
+                        && engine.direction() == env.direction(i) && engine.length() == env.length(i)
+                        && engine.score() == env.score(i) && (!engine.hasFood() || engine.food() == env.food(i));
+            for (int y = 0; same && y < env.gridSize(); ++y) {
+                for (int x = 0; same && x < env.gridSize(); ++x) {
+                    same = engine.isBlocked(SnakeCell{x, y}) == env.isOccupied(i, SnakeCell{x, y});
+                }
+            }
+            if (!same) diverged[i] = true;
+        }
+    }
+
+    int count = static_cast<int>(std::count(diverged.begin(), diverged.end(), true));
+    std::printf("grid %4dx%-4d  %6d envs  %8lld steps  %s  against SnakeEngine  %10llu episodes  diverged %d\n",
+                env.gridSize(), env.gridSize(), envCount, steps, env.map() ? "walled map" : "empty     ",
+                static_cast<unsigned long long>(env.episodeCount()), count);
+    return count;
+}
+
+/**
+ * @brief Compares Rewinding A Short Lookahead With restore() Against Copying The Engine
+ */
+void benchSnapshot(int gridSize, int lookahead, long long rounds)
+{
+    SnakeEngine engine(gridSize, 99);
+    SnakeDirection direction = SnakeDirection::Right;
+    engine.loadBody(cycleBody(gridSize, gridSize * gridSize / 2, direction), direction);
+
+    SnakeEngine scratch = engine;
+    Clock::time_point start = Clock::now();
+    for (long long i = 0; i < rounds; ++i) {
+        scratch = engine;
+        for (int tick = 0; tick < lookahead; ++tick) {
+            scratch.step(cycleDirection(scratch.head(), gridSize));
+        }
+    }
+    double copySeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    SnakeEngine::Checkpoint checkpoint = engine.save();
+    start = Clock::now();
+    for (long long i = 0; i < rounds; ++i) {
+        for (int tick = 0; tick < lookahead; ++tick) {
+            engine.step(cycleDirection(engine.head(), gridSize));
+        }
+        engine.restore(checkpoint);
+    }
+    double restoreSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("grid %4dx%-4d  length %6d  lookahead %3d ticks  copy+play %9.1f ns  play+restore %9.1f ns\n",
+                gridSize, gridSize, engine.length(), lookahead,
+                copySeconds * 1e9 / rounds, restoreSeconds * 1e9 / rounds);
+}
+
+/**
+ * @brief Plays Whole Games With The MCTS Autopilot And Reports Search Throughput
+ */
+void benchMcts(int gridSize, int games, int threads, int iterations)
+{
+    MctsStrategy strategy(threads, iterations);
+    const long long stallLimit = 4LL * gridSize * gridSize;
+    long long decisions = 0;
+    long long totalLength = 0;
+    int wins = 0;
+    double decideSeconds = 0;
+
+    for (int game = 0; game < games; ++game) {
+        SnakeEngine engine(gridSize, 3000 + game);
+        long long sinceFood = 0;
+        while (!engine.isGameOver() && sinceFood <= stallLimit) {
+            Clock::time_point start = Clock::now();
+            SnakeDirection direction = strategy.decide(engine);
+            decideSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+            ++decisions;
+            sinceFood = engine.step(direction) == SnakeStepResult::Ate ? 0 : sinceFood + 1;
+        }
+        totalLength += engine.length();
+        wins += engine.hasWon() ? 1 : 0;
+    }
+
+    std::printf("grid %4dx%-4d  mcts %d threads x %d iterations  %10.0f rollouts/s  %8.1f decisions/s  "
+                "avg final length %6.1f  wins %d/%d\n",
+                gridSize, gridSize, threads, iterations, strategy.rolloutCount() / decideSeconds,
+                decisions / decideSeconds, double(totalLength) / games, wins, games);
+}
+
+/**
+ * @brief Drives SnakeTickScheduler In Real Time Like The Widget's Render Loop
+ *
+ * Sleeps until the earlier of the next frame or tick deadline, rounded up to
+ * whole milliseconds as a precise QTimer would be, and stalls for three
+ * ticks once a second to exercise catch-up. Reports how late ticks ran and
+ * how close the achieved tick rate came to the nominal one.
+ */
+void benchScheduler(int intervalMs, int frameRate, double seconds)
+{
+    Clock::time_point origin = Clock::now();
+    auto nowNs = [origin]() {
+        return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - origin).count());
+    };
+
+    SnakeTickScheduler scheduler;
+    const std::int64_t framePeriodNs = 1000000000LL / frameRate;
+    const std::int64_t endNs = static_cast<std::int64_t>(seconds * 1e9);
+    std::int64_t now = nowNs();
+    std::int64_t nextFrameNs = now;
+    std::int64_t nextStallNs = now + 1000000000LL;
+    scheduler.start(now, std::int64_t(intervalMs) * 1000000);
+
+    while (now < endNs) {
+        scheduler.advance(now);
+        if (now >= nextStallNs) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(3 * intervalMs));
+            nextStallNs += 1000000000LL;
+        }
+
+        now = nowNs();
+        if (nextFrameNs <= now) {
+            nextFrameNs += framePeriodNs;
+            if (nextFrameNs <= now) nextFrameNs = now + framePeriodNs;
+        }
+        std::int64_t wakeNs = std::min(nextFrameNs, scheduler.nextDeadlineNs());
+        std::this_thread::sleep_for(std::chrono::milliseconds((wakeNs - now + 999999) / 1000000));
+        now = nowNs();
+    }
+
+    const SnakeHistogram &lateness = scheduler.lateness();
+    const SnakeHistogram &intervals = scheduler.intervals();
+    std::printf("tick %3d ms  frames %3d Hz  ticks %6llu  rate %8.3f/s (nominal %8.3f)  "
+                "late p50 %6.3f p99 %6.3f max %7.3f ms  interval mean %7.3f ms  caught up %llu  dropped %llu\n",
+                intervalMs, frameRate, static_cast<unsigned long long>(scheduler.tickCount()),
+                scheduler.tickRate(now), 1000.0 / intervalMs,
+                lateness.percentileNs(0.5) / 1e6, lateness.percentileNs(0.99) / 1e6, lateness.maxNs() / 1e6,
+                intervals.meanNs() / 1e6,
+                static_cast<unsigned long long>(scheduler.lateTicks()),
+                static_cast<unsigned long long>(scheduler.droppedTicks()));
+}
+
+/**
+ * @brief Simulates Corner Turns Typed Faster Than The Tick Rate
+ *
+ * The player presses pairs of keys 10-70 ms apart to turn back through a
+ * corner, then pauses for one to four ticks. Ticks fall on an exact grid and a
+ * tick wakes the render loop (up to 1 ms late, as a precise timer may be)
+ * so each applied turn is painted right after its tick. The old single
+ * m_nextDirection slot is modelled alongside to count turns it loses.
+ */
+void benchInput(int intervalMs, int pairs)
+{
+    const std::int64_t tickNs = std::int64_t(intervalMs) * 1000000;
+    const std::int64_t wakeNs = 1000000;
+    SnakeRandom rng(17);
+    SnakeInputQueue queue;
+    SnakeHistogram latency(500000, 1024);
+    int applied = 0;
+    int lostBySlot = 0;
+
+    SnakeDirection direction = SnakeDirection::Right;
+    std::int64_t pressNs = 0;
+    for (int pair = 0; pair < pairs; ++pair) {
+        // Two Presses That Reverse Through A Corner (Moving Right: Up Then Left), The Case
+        // Where Losing The First Press Also Gets The Second Rejected As A Reversal
+        bool horizontal = direction == SnakeDirection::Left || direction == SnakeDirection::Right;
+        SnakeDirection first = horizontal ? (rng.bounded(2) ? SnakeDirection::Up : SnakeDirection::Down)
+                                          : (rng.bounded(2) ? SnakeDirection::Left : SnakeDirection::Right);
+        SnakeDirection second = oppositeDirection(direction);
+        std::int64_t presses[2] = { pressNs, pressNs + (10 + std::int64_t(rng.bounded(61))) * 1000000 };
+        SnakeDirection keys[2] = { first, second };
+
+        // Old Slot: A Second Press Before The Next Tick Overwrites The First
+        std::int64_t firstTick = (presses[0] / tickNs + 1) * tickNs;
+        if (presses[1] < firstTick) ++lostBySlot;
+
+        // Queue: Feed Presses And Ticks In Time Order
+        int next = 0;
+        for (std::int64_t tick = firstTick; next < 2 || !queue.isEmpty(); tick += tickNs) {
+            while (next < 2 && presses[next] < tick) {
+                queue.push(keys[next], presses[next], direction);
+                ++next;
+            }
+            if (!queue.isEmpty()) {
+                SnakeInput input = queue.pop();
+                direction = input.direction;
+                latency.record(tick + wakeNs - input.timestampNs);
+                ++applied;
+            }
+            pressNs = tick;
+        }
+        pressNs += (1 + std::int64_t(rng.bounded(4))) * tickNs + std::int64_t(rng.bounded(std::uint32_t(tickNs / 1000))) * 1000;
+    }
+
+    std::printf("tick %3d ms  turns %6d  applied %6d  lost by single slot %6d  "
+                "key-to-frame p50 %6.1f p99 %6.1f max %6.1f ms\n",
+                intervalMs, 2 * pairs, applied, lostBySlot,
+                latency.percentileNs(0.5) / 1e6, latency.percentileNs(0.99) / 1e6, latency.maxNs() / 1e6);
+}
+
+/**
+ * @brief Order Dependent Hash Of Every Snake Body And Food Item, To Compare Runs
+ */
+std::uint64_t arenaHash(const SnakeArena &arena)
+{
+    std::uint64_t hash = 1469598103934665603ull;
+    auto mix = [&hash](std::uint64_t value) { hash = (hash ^ value) * 1099511628211ull; };
+    for (int i = 0; i < arena.snakeCount(); ++i) {
+        const SnakeArena::Snake &snake = arena.snake(i);
+        mix(snake.alive ? static_cast<std::uint64_t>(snake.body.size()) : 0);
+        if (!snake.alive) continue;
+        for (const SnakeCell &cell : snake.body) {
+            mix(static_cast<std::uint64_t>(cell.y) * 65536 + cell.x);
+        }
+    }
+    for (int slot = 0; slot < arena.foodCount(); ++slot) {
+        SnakeCell food = arena.food(slot);
+        mix(static_cast<std::uint64_t>(food.y) * 65536 + food.x);
+    }
+    return hash;
+}
+
+/**
+ * @brief Runs An AI Arena, Timing The Decision And Move Phases Separately
+ * @param threads Decision Workers, 1 Decides On The Calling Thread Without A Pool
+ */
+std::uint64_t benchArena(int snakes, int gridSize, int foodCount, int ticks, int threads)
+{
+    SnakeArena arena(gridSize, snakes, foodCount, 2024);
+    arena.setRespawnTicks(30);
+    std::unique_ptr<SnakeThreadPool> pool(threads > 1 ? new SnakeThreadPool(threads) : nullptr);
+
+    double decideSeconds = 0;
+    double stepSeconds = 0;
+    double worstTick = 0;
+    long long deaths = 0;
+    long long headOn = 0;
+    long long aliveSum = 0;
+    for (int tick = 0; tick < ticks; ++tick) {
+        Clock::time_point start = Clock::now();
+        arena.decide(pool.get());
+        Clock::time_point decided = Clock::now();
+        arena.step();
+        Clock::time_point stepped = Clock::now();
+
+        decideSeconds += std::chrono::duration<double>(decided - start).count();
+        stepSeconds += std::chrono::duration<double>(stepped - decided).count();
+        worstTick = std::max(worstTick, std::chrono::duration<double>(stepped - start).count());
+        deaths += arena.lastDeaths();
+        headOn += arena.lastHeadOnDeaths();
+        aliveSum += arena.aliveCount();
+    }
+    std::uint64_t hash = arenaHash(arena);
+
+    double total = decideSeconds + stepSeconds;
+    std::printf("grid %4dx%-4d  %5d snakes  %5d food  %2d threads  %9.0f ticks/s  decide %7.1f us  "
+                "step %6.1f us  worst %7.2f ms  alive %6.1f  deaths %6lld (head-on %5lld)  hash %016llx\n",
+                gridSize, gridSize, snakes, foodCount, threads, ticks / total, decideSeconds * 1e6 / ticks,
+                stepSeconds * 1e6 / ticks, worstTick * 1e3, double(aliveSum) / ticks, deaths, headOn,
+                static_cast<unsigned long long>(hash));
+    return hash;
+}
+
+/**
+ * @brief Builds, Caches And Memory-Maps A Map's Fields, Then Times A* With And Without Them
+ */
+void benchMapFields(int gridSize, int room, int searches, const std::string &cacheDirectory)
+{
+    SnakeMap map = roomMap(gridSize, room, 5);
+    std::vector<std::uint8_t> file = map.serialize();
+    SnakeMap decoded;
+    bool roundTrip = SnakeMap::deserialize(file.data(), file.size(), decoded) && decoded.hash() == map.hash();
+
+    Clock::time_point start = Clock::now();
+    std::shared_ptr<SnakeMapFields> built = SnakeMapFields::build(map);
+    double buildSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::string path = cacheDirectory + "/" + SnakeMapFields::cacheFileName(map);
+    built->save(path);
+    start = Clock::now();
+    std::shared_ptr<SnakeMapFields> mapped = SnakeMapFields::open(path, map);
+    double openSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (!mapped) {
+        std::printf("grid %4dx%-4d  could not map %s\n", gridSize, gridSize, path.c_str());
+        return;
+    }
+
+    std::vector<std::uint8_t> blocked(static_cast<std::size_t>(gridSize) * gridSize, 0);
+    std::vector<int> freeCells;
+    for (int cell = 0; cell < gridSize * gridSize; ++cell) {
+        blocked[cell] = map.isWall(SnakeCell{cell % gridSize, cell / gridSize}) ? 1 : 0;
+        if (!blocked[cell]) freeCells.push_back(cell);
+    }
+    SnakeRandom rng(11);
+    std::vector<std::pair<int, int>> pairs(searches);
+    for (std::pair<int, int> &pair : pairs) {
+        pair.first = freeCells[rng.bounded(static_cast<std::uint32_t>(freeCells.size()))];
+        pair.second = freeCells[rng.bounded(static_cast<std::uint32_t>(freeCells.size()))];
+    }
+
+    // Same Searches With The Manhattan Heuristic And With The Mapped Landmark Bounds
+    SnakeGridSearch search;
+    search.prepare(gridSize);
+    std::vector<int> path1;
+    std::vector<int> path2;
+    double seconds[2] = { 0, 0 };
+    long long lengths[2] = { 0, 0 };
+    int mismatches = 0;
+    for (const std::pair<int, int> &pair : pairs) {
+        search.setFields(nullptr);
+        start = Clock::now();
+        int plain = search.aStarPath(blocked, pair.first, pair.second, path1);
+        seconds[0] += std::chrono::duration<double>(Clock::now() - start).count();
+
+        search.setFields(mapped.get());
+        start = Clock::now();
+        int landmarks = search.aStarPath(blocked, pair.first, pair.second, path2);
+        seconds[1] += std::chrono::duration<double>(Clock::now() - start).count();
+
+        lengths[0] += plain;
+        lengths[1] += landmarks;
+        mismatches += plain == landmarks ? 0 : 1;
+    }
+
+    std::printf("grid %4dx%-4d  map %7zu bytes%s  fields %6.1f MB  build %8.1f ms  mmap open %6.3f ms  cycle %s\n",
+                gridSize, gridSize, file.size(), roundTrip ? "" : " (ROUND TRIP FAILED)",
+                mapped->isMapped() ? std::filesystem::file_size(path) / 1e6 : 0.0, buildSeconds * 1e3,
+                openSeconds * 1e3, mapped->cycleLength() == map.freeCellCount() ? "covers every free cell" : "MISSING");
+    std::printf("               A* %d searches  manhattan %9.3f ms/search  landmarks %9.3f ms/search  "
+                "avg path %.0f  length mismatches %d\n",
+                searches, seconds[0] * 1e3 / searches, seconds[1] * 1e3 / searches,
+                double(lengths[1]) / searches, mismatches);
+}
+
+/**
+ * @brief Plays Autopilot Games On A Walled Map With Cached Fields Attached
+ */
+void benchMapGames(int gridSize, int room, int games, const std::string &cacheDirectory)
+{
+    auto map = std::make_shared<SnakeMap>(roomMap(gridSize, room, 9));
+    bool fromCache = false;
+    map->setFields(SnakeMapFields::loadOrBuild(cacheDirectory, *map, &fromCache));
+
+    for (SnakeAutopilotKind kind : { SnakeAutopilotKind::AStar, SnakeAutopilotKind::Hamiltonian }) {
+        std::unique_ptr<SnakeStrategy> strategy = createSnakeStrategy(kind);
+        long long totalLength = 0;
+        long long ticks = 0;
+        int wins = 0;
+        Clock::time_point start = Clock::now();
+        for (int game = 0; game < games; ++game) {
+            SnakeEngine engine(gridSize, 500 + game);
+            engine.setMap(map);
+            long long sinceFood = 0;
+            while (!engine.isGameOver() && sinceFood <= 4LL * gridSize * gridSize) {
+                sinceFood = engine.step(strategy->decide(engine)) == SnakeStepResult::Ate ? 0 : sinceFood + 1;
+                ++ticks;
+            }
+            totalLength += engine.length();
+            wins += engine.hasWon() ? 1 : 0;
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        std::printf("grid %4dx%-4d  %zu walls  %-12s  avg final length %7.1f of %d free  wins %d/%d  "
+                    "%9.0f ticks/s%s\n",
+                    gridSize, gridSize, static_cast<std::size_t>(map->wallCount()), strategy->name(),
+                    double(totalLength) / games, map->freeCellCount(), wins, games, ticks / seconds,
+                    fromCache ? "  (fields from cache)" : "");
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Benchmark Entry Point
+ *
+ * Usage: snakebench [ticks] [gridSize]
+ *        snakebench --scaling [ticks]
+ *        snakebench --autopilot [games] [gridSize]   (exit 1 when A* dies on the walled map)
+ *        snakebench --replay [games] [gridSize]
+ *        snakebench --batch [envs] [steps] [gridSize]   (exit 1 when a game diverges from SnakeEngine)
+ *        snakebench --mcts [games] [gridSize] [threads] [iterations]
+ *        snakebench --scheduler [seconds]
+ *        snakebench --input [pairs]
+ *        snakebench --arena [snakes] [gridSize] [ticks] [threads]
+ *        snakebench --map [gridSize] [cacheDir]
+ */
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && std::strcmp(argv[1], "--scaling") == 0) {
+        long long ticks = argc > 2 ? std::atoll(argv[2]) : 20000;
+        benchScaling(30, ticks);
+        benchScaling(1000, ticks);
+        benchScaling(SnakeEngine::MaxGridSize, ticks, 0.10);
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--scheduler") == 0) {
+        double seconds = argc > 2 ? std::atof(argv[2]) : 3.0;
+        for (int interval : {200, 150, 100, 16}) {
+            benchScheduler(interval, 60, seconds);
+        }
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--input") == 0) {
+        int pairs = argc > 2 ? std::atoi(argv[2]) : 100000;
+        for (int interval : {200, 150, 100}) {
+            benchInput(interval, pairs);
+        }
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--map") == 0) {
+        int gridSize = argc > 2 ? std::atoi(argv[2]) : 1000;
+        std::string cache = argc > 3 ? argv[3] : "snakebench-maps";
+        std::error_code error;
+        std::filesystem::create_directories(cache, error);
+        benchMapFields(gridSize, 16, 200, cache);
+        benchMapGames(20, 10, 20, cache);
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--arena") == 0) {
+        int snakes = argc > 2 ? std::atoi(argv[2]) : 500;
+        int gridSize = argc > 3 ? std::atoi(argv[3]) : 512;
+        int ticks = argc > 4 ? std::atoi(argv[4]) : 3000;
+        int threads = argc > 5 ? std::atoi(argv[5]) : static_cast<int>(std::thread::hardware_concurrency());
+        std::uint64_t single = benchArena(snakes, gridSize, 2 * snakes, ticks, 1);
+        std::uint64_t parallel = benchArena(snakes, gridSize, 2 * snakes, ticks, std::max(2, threads));
+        std::printf("parallel decisions %s the single threaded run\n", single == parallel ? "match" : "DIFFER FROM");
+        return single == parallel ? 0 : 1;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--autopilot") == 0) {
+        int games = argc > 2 ? std::atoi(argv[2]) : 20;
+        int gridSize = argc > 3 ? std::atoi(argv[3]) : 30;
+        benchAutopilot(gridSize, games);
+
+        // Same Games On The Walled Room Map, Where A* Must Still Never Die
+        auto map = std::make_shared<const SnakeMap>(roomMap(20, 10, 9));
+        int deaths = benchAutopilot(20, games, map);
+        if (deaths > 0) {
+            std::printf("A* DIED %d TIMES ON THE WALLED MAP\n", deaths);
+            return 1;
+        }
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--replay") == 0) {
+        int games = argc > 2 ? std::atoi(argv[2]) : 20;
+        int gridSize = argc > 3 ? std::atoi(argv[3]) : 20;
+        benchReplay(gridSize, games);
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--batch") == 0) {
+        int envCount = argc > 2 ? std::atoi(argv[2]) : 4096;
+        long long steps = argc > 3 ? std::atoll(argv[3]) : 2000;
+        int gridSize = argc > 4 ? std::atoi(argv[4]) : 20;
+        benchBatch(envCount, gridSize, steps, false);
+        benchBatch(envCount, gridSize, steps / 10, true);
+
+        // Every Game Must Match SnakeEngine Step For Step, On The Empty Board And On Walls
+        int diverged = checkBatch(64, gridSize, 2000);
+        diverged += checkBatch(64, 20, 2000, std::make_shared<const SnakeMap>(roomMap(20, 10, 9)));
+        if (diverged > 0) {
+            std::printf("BATCH DIVERGED FROM SnakeEngine IN %d GAMES\n", diverged);
+            return 1;
+        }
+        return 0;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--mcts") == 0) {
+        int games = argc > 2 ? std::atoi(argv[2]) : 3;
+        int gridSize = argc > 3 ? std::atoi(argv[3]) : 10;
+        int threads = argc > 4 ? std::atoi(argv[4]) : 0;
+        int iterations = argc > 5 ? std::atoi(argv[5]) : 256;
+        for (int size : {gridSize, 100}) {
+            benchSnapshot(size, 4, 20000);
+            benchSnapshot(size, 2 * size, 20000);
+        }
+        benchMcts(gridSize, games, threads, iterations);
+        return 0;
+    }
+
+    long long ticks = argc > 1 ? std::atoll(argv[1]) : 5000000;
+    int gridSize = argc > 2 ? std::atoi(argv[2]) : 0;
+
+    if (gridSize > 0) {
+        benchTicks(gridSize, ticks);
+        return 0;
+    }
+
+    for (int size : {12, 20, 30}) {
+        benchTicks(size, ticks);
+    }
+    return 0;
+}
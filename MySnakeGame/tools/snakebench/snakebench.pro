@@ -0,0 +1,43 @@
+# Headless Console Benchmark For The Snake Engine (No Qt Required)
+CONFIG += console c++17 thread
+CONFIG -= qt app_bundle
+CONFIG += release
+
+TARGET = snakebench
+
+# Engine Sources Are Shared With The Game
+INCLUDEPATH += ../..
+
+# Source Files To Be Compiled
+SOURCES += \
+    main.cpp \
+    ../../snakearena.cpp \
+    ../../snakeautopilot.cpp \
+    ../../snakebatchenv.cpp \
+    ../../snakeengine.cpp \
+    ../../snakemap.cpp \
+    ../../snakemapfields.cpp \
+    ../../snakemcts.cpp \
+    ../../snakereplay.cpp \
+    ../../snakethreadpool.cpp \
+    ../../snaketickscheduler.cpp
+
+# Header Files Containing Class Declarations
+HEADERS += \
+    ../../snakearena.h \
+    ../../snakeautopilot.h \
+    ../../snakebatchenv.h \
+    ../../snakebits.h \
+    ../../snakebody.h \
+    ../../snakeengine.h \
+    ../../snakefreecells.h \
+    ../../snakehistogram.h \
+    ../../snakeinputqueue.h \
+    ../../snakemap.h \
+    ../../snakemapfields.h \
+    ../../snakemcts.h \
+    ../../snakerandom.h \
+    ../../snakereplay.h \
+    ../../snakethreadpool.h \
+    ../../snaketickscheduler.h \
+    ../../snaketypes.h
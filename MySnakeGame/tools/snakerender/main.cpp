@@ -0,0 +1,523 @@
+#include "snakeautopilot.h"
+#include "snakeengine.h"
+#include "snakemap.h"
+#include "snakerenderer.h"
+#include "snakereplay.h"
+#include "snakethreadpool.h"
+#include <QByteArray>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QImage>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Direction Along The Serpentine Hamiltonian Cycle snakebench Uses
+ */
+SnakeDirection cycleDirection(SnakeCell cell, int gridSize)
+{
+    if (cell.x == 0) {
+        return cell.y == 0 ? SnakeDirection::Right : SnakeDirection::Up;
+    }
+    if (cell.y % 2 == 0) {
+        return cell.x < gridSize - 1 ? SnakeDirection::Right : SnakeDirection::Down;
+    }
+    if (cell.x > 1 || cell.y == gridSize - 1) {
+        return SnakeDirection::Left;
+    }
+    return SnakeDirection::Down;
+}
+
+/**
+ * @brief Lays A Snake Of The Given Length Along The Cycle, Head First
+ */
+std::vector<SnakeCell> cycleBody(int gridSize, int length, SnakeDirection &direction)
+{
+    std::vector<SnakeCell> path;
+    path.reserve(length);
+    SnakeCell cell{0, 0};
+    for (int i = 0; i < length; ++i) {
+        path.push_back(cell);
+        direction = cycleDirection(cell, gridSize);
+        SnakeCell delta = directionDelta(direction);
+        cell = SnakeCell{cell.x + delta.x, cell.y + delta.y};
+    }
+    direction = cycleDirection(path.size() > 1 ? path[path.size() - 2] : path.back(), gridSize);
+    return std::vector<SnakeCell>(path.rbegin(), path.rend());
+}
+
+/**
+ * @brief Centres The Arena Camera On The Head, Clamped To The World Like The Widget
+ */
+QPointF cameraOnHead(const SnakeEngine &engine, const SnakeRenderState &state)
+{
+    SnakeCell head = engine.head();
+    qreal worldSize = qreal(engine.gridSize()) * state.cellSize;
+    return QPointF(qBound(0.0, (head.x + 0.5) * state.cellSize - state.size.width() / 2.0,
+                          qMax(0.0, worldSize - state.size.width())),
+                   qBound(0.0, (head.y + 0.5) * state.cellSize - state.size.height() / 2.0,
+                          qMax(0.0, worldSize - state.size.height())));
+}
+
+/**
+ * @brief Frames Per Second For One Grid Size And Snake Length
+ *
+ * The head and tail tween advances every frame so the interpolated path is
+ * exercised; the layer and sprite caches are warm after the first frame.
+ */
+void benchRender(int gridSize, int length, int cellSize, QSize size, bool arena, int frames)
+{
+    SnakeEngine engine(gridSize, 7);
+    SnakeDirection direction = SnakeDirection::Right;
+    engine.loadBody(cycleBody(gridSize, length, direction), direction);
+
+    SnakeRenderState state;
+    state.size = size;
+    state.cellSize = cellSize;
+    state.arena = arena;
+    state.camera = arena ? cameraOnHead(engine, state) : QPointF();
+
+    SnakeRenderer renderer;
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    {
+        QPainter warmUp(&image);
+        renderer.render(warmUp, engine, state);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int frame = 0; frame < frames; ++frame) {
+        state.tickProgress = (frame % 8) / 8.0;
+        QPainter painter(&image);
+        renderer.render(painter, engine, state);
+    }
+    double seconds = timer.nsecsElapsed() / 1e9;
+
+    std::printf("grid %4dx%-4d  length %8d  %4dx%-4d %s  %9.1f frames/s  %8.3f ms/frame\n",
+                gridSize, gridSize, engine.length(), size.width(), size.height(), arena ? "arena" : "board",
+                frames / seconds, seconds * 1e3 / frames);
+}
+
+// One Golden Image: A Seeded Hamiltonian Game Rendered After A Fixed Number Of Ticks
+struct GoldenScene
+{
+    const char *name;
+    int gridSize;
+    int difficulty;
+    std::uint64_t seed;
+    int ticks;
+    int cellSize;
+    qreal tickProgress;
+    bool arena;
+};
+
+const GoldenScene GoldenScenes[] = {
+    { "easy_start",      17, 0,  1,    0, 30, 1.0,  false },
+    { "medium_mid_tween", 20, 1,  2,  400, 30, 0.5,  false },
+    { "hard_long",       24, 2,  3, 3000, 25, 0.25, false },
+    { "arena_scroll",   256, 1,  4, 2000, 20, 0.75, true  },
+};
+
+/**
+ * @brief Plays A Scene's Game And Renders It Without The Font Dependent HUD
+ */
+QImage renderScene(const GoldenScene &scene)
+{
+    SnakeEngine engine(scene.gridSize, scene.seed);
+    std::unique_ptr<SnakeStrategy> strategy = createSnakeStrategy(SnakeAutopilotKind::Hamiltonian);
+    for (int tick = 0; tick < scene.ticks && !engine.isGameOver(); ++tick) {
+        engine.step(strategy->decide(engine));
+    }
+
+    SnakeRenderState state;
+    state.size = scene.arena ? QSize(640, 480) : QSize(scene.gridSize * scene.cellSize, scene.gridSize * scene.cellSize);
+    state.cellSize = scene.cellSize;
+    state.difficulty = scene.difficulty;
+    state.arena = scene.arena;
+    state.camera = scene.arena ? cameraOnHead(engine, state) : QPointF();
+    state.tickProgress = scene.tickProgress;
+    state.hud = false;
+
+    SnakeRenderer renderer;
+    return renderer.renderImage(engine, state).convertToFormat(QImage::Format_ARGB32);
+}
+
+/**
+ * @brief Writes Or Compares Every Golden Scene
+ * @param directory Folder Holding <scene>.png
+ * @param write Overwrite The Goldens Instead Of Checking Them
+ * @return Process Exit Code, 1 When Any Scene Differs Or Is Missing
+ */
+int runGolden(const QString &directory, bool write)
+{
+    QDir dir(directory);
+    if (write && !dir.mkpath(".")) {
+        std::fprintf(stderr, "snakerender: cannot create %s\n", qPrintable(directory));
+        return 1;
+    }
+
+    int failures = 0;
+    for (const GoldenScene &scene : GoldenScenes) {
+        QString path = dir.filePath(QString("%1.png").arg(scene.name));
+        QImage actual = renderScene(scene);
+
+        if (write) {
+            bool saved = actual.save(path, "PNG");
+            std::printf("%-18s %s\n", scene.name, saved ? "written" : "WRITE FAILED");
+            failures += saved ? 0 : 1;
+            continue;
+        }
+
+        QImage expected(path);
+        if (expected.isNull()) {
+            std::printf("%-18s MISSING %s\n", scene.name, qPrintable(path));
+            ++failures;
+            continue;
+        }
+        expected = expected.convertToFormat(QImage::Format_ARGB32);
+        if (expected.size() != actual.size()) {
+            std::printf("%-18s SIZE %dx%d, expected %dx%d\n", scene.name, actual.width(), actual.height(),
+                        expected.width(), expected.height());
+            ++failures;
+            continue;
+        }
+
+        // Count Differing Pixels And Keep A Red-On-Black Diff For Inspection
+        QImage diff(actual.size(), QImage::Format_ARGB32);
+        diff.fill(Qt::black);
+        long long differing = 0;
+        for (int y = 0; y < actual.height(); ++y) {
+            const QRgb *a = reinterpret_cast<const QRgb *>(actual.constScanLine(y));
+            const QRgb *e = reinterpret_cast<const QRgb *>(expected.constScanLine(y));
+            QRgb *d = reinterpret_cast<QRgb *>(diff.scanLine(y));
+            for (int x = 0; x < actual.width(); ++x) {
+                if (a[x] != e[x]) {
+                    ++differing;
+                    d[x] = qRgb(255, 0, 0);
+                }
+            }
+        }
+
+        if (differing == 0) {
+            std::printf("%-18s ok\n", scene.name);
+        } else {
+            std::printf("%-18s DIFFERS in %lld pixels\n", scene.name, differing);
+            actual.save(dir.filePath(QString("%1.actual.png").arg(scene.name)), "PNG");
+            diff.save(dir.filePath(QString("%1.diff.png").arg(scene.name)), "PNG");
+            ++failures;
+        }
+    }
+    return failures ? 1 : 0;
+}
+
+/**
+ * @brief Reads And Decodes A Replay File, Reporting Failures On stderr
+ */
+bool loadReplay(const char *path, SnakeReplay &replay)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        std::fprintf(stderr, "snakerender: cannot open %s\n", path);
+        return false;
+    }
+    QByteArray bytes = file.readAll();
+    if (!SnakeReplay::deserialize(reinterpret_cast<const std::uint8_t *>(bytes.constData()),
+                                  static_cast<std::size_t>(bytes.size()), replay)) {
+        std::fprintf(stderr, "snakerender: %s is not a Snake replay\n", path);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Gives The Engine The Level A Replay Was Recorded On
+ * @param mapPath Map File From --map, nullptr When None Was Given
+ * @return false, Reported On stderr, When The Replay Needs A Map That Was Not Given Or Does Not Match
+ */
+bool attachReplayMap(const SnakeReplay &replay, const char *mapPath, SnakeEngine &engine)
+{
+    if (!mapPath) {
+        if (replay.mapHash == 0) return true;
+        std::fprintf(stderr, "snakerender: replay was recorded on map %016llx, pass it with --map FILE\n",
+                     static_cast<unsigned long long>(replay.mapHash));
+        return false;
+    }
+
+    auto map = std::make_shared<SnakeMap>();
+    if (!SnakeMap::load(QFile::encodeName(QString::fromLocal8Bit(mapPath)).toStdString(), *map)) {
+        std::fprintf(stderr, "snakerender: cannot load map %s\n", mapPath);
+        return false;
+    }
+    if (map->hash() != replay.mapHash) {
+        std::fprintf(stderr, "snakerender: %s is map %016llx but the replay was recorded on %016llx\n", mapPath,
+                     static_cast<unsigned long long>(map->hash()), static_cast<unsigned long long>(replay.mapHash));
+        return false;
+    }
+    engine.setMap(map);
+    return true;
+}
+
+/**
+ * @brief Renders The State A Replay Reaches After tick Ticks (Or At Its End)
+ */
+int renderReplay(const char *replayPath, long long tick, const char *outputPath, int cellSize, const char *mapPath)
+{
+    SnakeReplay replay;
+    if (!loadReplay(replayPath, replay)) return 1;
+
+    SnakeEngine engine(replay.gridSize);
+    if (!attachReplayMap(replay, mapPath, engine)) return 1;
+    SnakeReplayPlayer player(replay);
+    player.start(engine);
+    while (!player.finished(engine) && (tick < 0 || static_cast<long long>(engine.tickCount()) < tick)) {
+        player.step(engine);
+    }
+
+    SnakeRenderState state;
+    state.size = QSize(replay.gridSize * cellSize, replay.gridSize * cellSize);
+    state.cellSize = cellSize;
+    state.difficulty = replay.difficulty;
+    state.score = engine.score();
+
+    SnakeRenderer renderer;
+    if (!renderer.renderImage(engine, state).save(outputPath)) {
+        std::fprintf(stderr, "snakerender: cannot write %s\n", outputPath);
+        return 1;
+    }
+    std::printf("tick %llu  length %d  -> %s\n", static_cast<unsigned long long>(engine.tickCount()),
+                engine.length(), outputPath);
+    return 0;
+}
+
+// Export Options Given After --export REPLAY OUTPUT
+struct ExportOptions
+{
+    bool raw = false;                   // One RGBA8888 Stream Instead Of Numbered PNGs
+    int threads = 0;                    // 0 = One Per Hardware Thread
+    int cellSize = 30;
+    int tweens = 1;                     // Frames Per Tick, Above 1 Adds In-Between Frames
+    const char *mapPath = nullptr;      // Level Of A Map Replay, Checked Against Its Hash
+};
+
+// Per-Thread Export State: Engine Positioned On Some Tick, Renderer Caches And A Frame Buffer
+struct ExportWorker
+{
+    SnakeEngine engine;
+    bool positioned = false;
+    SnakeRenderer renderer;
+    QImage image;
+};
+
+/**
+ * @brief Renders Every Tick Of A Replay, Spread Across A Thread Pool
+ *
+ * One sequential pass replays the game, storing the direction applied on
+ * every tick and a copy of the engine every keyframeTicks ticks. The pool
+ * hands each worker a contiguous ascending run of frames, so a worker asked
+ * for a frame normally steps its own engine forward from the previous one.
+ * It restarts from the nearest keyframe only when the frame lies behind its
+ * engine (a stolen frame) or that keyframe is closer, so no frame costs more
+ * than keyframeTicks engine steps.
+ *
+ * PNG frames are written by the workers themselves. The raw stream must be
+ * in order, so frames are rendered in batches of a few per thread and then
+ * written sequentially, which bounds memory whatever the replay length.
+ */
+int exportReplay(const char *replayPath, const char *outputPath, const ExportOptions &options)
+{
+    SnakeReplay replay;
+    if (!loadReplay(replayPath, replay)) return 1;
+
+    // Sequential Pass: Directions Per Tick Plus Keyframes
+    SnakeEngine engine(replay.gridSize);
+    if (!attachReplayMap(replay, options.mapPath, engine)) return 1;
+    SnakeReplayPlayer player(replay);
+    player.start(engine);
+    const int keyframeTicks = 64;
+    std::vector<SnakeEngine> keyframes(1, engine);
+    std::vector<SnakeDirection> directions;
+    directions.reserve(replay.tickCount);
+    while (!player.finished(engine)) {
+        player.step(engine);
+        // A Rejected Reversal Keeps The Old Direction, So Re-Stepping With direction() Is Exact
+        directions.push_back(engine.direction());
+        if (engine.tickCount() % keyframeTicks == 0) keyframes.push_back(engine);
+    }
+    const long long ticks = static_cast<long long>(directions.size());
+    const int tweens = std::max(1, options.tweens);
+    const long long frameCount = 1 + ticks * tweens;
+
+    // Boards Too Large For One Image Are Filmed Through A Camera On The Head
+    SnakeRenderState base;
+    base.cellSize = options.cellSize;
+    base.difficulty = replay.difficulty;
+    base.arena = replay.gridSize * options.cellSize > 2048;
+    base.size = base.arena ? QSize(960, 720) : QSize(replay.gridSize * options.cellSize, replay.gridSize * options.cellSize);
+
+    QDir dir(QString::fromLocal8Bit(outputPath));
+    std::FILE *raw = nullptr;
+    if (options.raw) {
+        raw = std::strcmp(outputPath, "-") == 0 ? stdout : std::fopen(outputPath, "wb");
+        if (!raw) {
+            std::fprintf(stderr, "snakerender: cannot open %s\n", outputPath);
+            return 1;
+        }
+    } else if (!dir.mkpath(".")) {
+        std::fprintf(stderr, "snakerender: cannot create %s\n", outputPath);
+        return 1;
+    }
+
+    SnakeThreadPool pool(options.threads);
+    std::vector<ExportWorker> workers(pool.threadCount());
+    std::atomic<int> writeFailures(0);
+
+    auto renderFrame = [&](long long frame, ExportWorker &worker) -> QImage & {
+        long long tick = frame == 0 ? 0 : (frame - 1) / tweens + 1;
+        int tween = frame == 0 ? tweens - 1 : static_cast<int>((frame - 1) % tweens);
+
+        // Step Forward From The Worker's Own State Or Restart From The Keyframe When It Is Closer
+        long long current = static_cast<long long>(worker.engine.tickCount());
+        if (!worker.positioned || current > tick || tick - current > tick % keyframeTicks) {
+            worker.engine = keyframes[static_cast<std::size_t>(tick / keyframeTicks)];
+            worker.positioned = true;
+        }
+        while (static_cast<long long>(worker.engine.tickCount()) < tick) {
+            worker.engine.step(directions[worker.engine.tickCount()]);
+        }
+
+        SnakeRenderState state = base;
+        state.tickProgress = tick == 0 ? 1.0 : qreal(tween + 1) / tweens;
+        state.score = worker.engine.score();
+        if (state.arena) state.camera = cameraOnHead(worker.engine, state);
+
+        if (worker.image.size() != state.size) {
+            worker.image = QImage(state.size, QImage::Format_RGBA8888_Premultiplied);
+        }
+        worker.image.fill(Qt::black);
+        QPainter painter(&worker.image);
+        worker.renderer.render(painter, worker.engine, state);
+        return worker.image;
+    };
+
+    QElapsedTimer timer;
+    timer.start();
+    if (!raw) {
+        pool.run(static_cast<int>(frameCount), [&](int frame, int index) {
+            QImage &image = renderFrame(frame, workers[index]);
+            if (!image.save(dir.filePath(QString("frame_%1.png").arg(frame, 6, 10, QChar('0'))), "PNG")) {
+                ++writeFailures;
+            }
+        });
+    } else {
+        const int batch = 4 * pool.threadCount();
+        std::vector<QImage> frames(static_cast<std::size_t>(batch));
+        for (long long first = 0; first < frameCount; first += batch) {
+            int count = static_cast<int>(std::min<long long>(batch, frameCount - first));
+            pool.run(count, [&](int offset, int index) {
+                frames[static_cast<std::size_t>(offset)] = renderFrame(first + offset, workers[index]).copy();
+            });
+            for (int i = 0; i < count; ++i) {
+                const QImage &image = frames[static_cast<std::size_t>(i)];
+                for (int y = 0; y < image.height(); ++y) {
+                    std::fwrite(image.constScanLine(y), 4, static_cast<std::size_t>(image.width()), raw);
+                }
+            }
+        }
+        if (raw != stdout) std::fclose(raw);
+    }
+    double seconds = timer.nsecsElapsed() / 1e9;
+
+    std::fprintf(stderr, "%lld ticks, %lld frames %dx%d on %d threads in %.2f s (%.1f frames/s)%s\n",
+                 ticks, frameCount, base.size.width(), base.size.height(), pool.threadCount(), seconds,
+                 frameCount / seconds, options.raw ? ", raw RGBA8888 premultiplied" : "");
+    if (writeFailures.load() > 0) {
+        std::fprintf(stderr, "snakerender: %d frames could not be written\n", writeFailures.load());
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+/**
+ * @brief Offscreen Renderer Entry Point
+ *
+ * Usage: snakerender --bench [frames]
+ *        snakerender --golden-write DIR
+ *        snakerender --golden-check DIR
+ *        snakerender --replay FILE OUTPUT.png [tick] [cellSize] [--map MAP]
+ *        snakerender --export FILE OUTDIR|OUTFILE|- [--raw] [--threads N] [--cell N] [--tweens N] [--map MAP]
+ *
+ * Replays recorded on a level need the same map file; its hash must match.
+ * Runs on the offscreen platform unless QT_QPA_PLATFORM is already set, so
+ * no display is needed.
+ */
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
+
+    if (argc > 2 && (std::strcmp(argv[1], "--golden-write") == 0 || std::strcmp(argv[1], "--golden-check") == 0)) {
+        return runGolden(QString::fromLocal8Bit(argv[2]), std::strcmp(argv[1], "--golden-write") == 0);
+    }
+
+    if (argc > 3 && std::strcmp(argv[1], "--replay") == 0) {
+        // Positional tick And cellSize, With --map MAP Allowed Anywhere After The Output
+        const char *mapPath = nullptr;
+        std::vector<const char *> positional;
+        for (int i = 4; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--map") == 0) mapPath = i + 1 < argc ? argv[++i] : "";
+            else positional.push_back(argv[i]);
+        }
+        long long tick = positional.size() > 0 ? std::atoll(positional[0]) : -1;
+        int cellSize = positional.size() > 1 ? std::max(2, std::atoi(positional[1])) : 30;
+        return renderReplay(argv[2], tick, argv[3], cellSize, mapPath);
+    }
+
+    if (argc > 3 && std::strcmp(argv[1], "--export") == 0) {
+        ExportOptions options;
+        for (int i = 4; i < argc; ++i) {
+            const char *value = i + 1 < argc ? argv[i + 1] : "";
+            if (std::strcmp(argv[i], "--raw") == 0) options.raw = true;
+            else if (std::strcmp(argv[i], "--threads") == 0) { options.threads = std::max(0, std::atoi(value)); ++i; }
+            else if (std::strcmp(argv[i], "--cell") == 0) { options.cellSize = std::max(2, std::atoi(value)); ++i; }
+            else if (std::strcmp(argv[i], "--tweens") == 0) { options.tweens = std::max(1, std::atoi(value)); ++i; }
+            else if (std::strcmp(argv[i], "--map") == 0) { options.mapPath = value; ++i; }
+        }
+        return exportReplay(argv[2], argv[3], options);
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) {
+        int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 500;
+        for (int gridSize : {20, 100}) {
+            int cellSize = 600 / gridSize;
+            int cells = gridSize * gridSize;
+            for (int length : {3, cells / 4, cells / 2, cells * 9 / 10}) {
+                benchRender(gridSize, length, cellSize, QSize(600, 600), false, frames);
+            }
+        }
+        for (int gridSize : {1000, SnakeEngine::MaxGridSize}) {
+            long long cells = static_cast<long long>(gridSize) * gridSize;
+            for (long long length : {3LL, cells / 100, cells / 10}) {
+                benchRender(gridSize, static_cast<int>(length), 20, QSize(800, 600), true, frames);
+            }
+        }
+        return 0;
+    }
+
+    std::fprintf(stderr, "usage: snakerender --bench [frames] | --golden-write DIR | --golden-check DIR | "
+                         "--replay FILE OUTPUT.png [tick] [cellSize] [--map MAP] | "
+                         "--export FILE OUTDIR|OUTFILE|- [--raw] [--threads N] [--cell N] [--tweens N] [--map MAP]\n");
+    return 2;
+}
@@ -0,0 +1,43 @@
+# Offscreen Snake Renderer: Render Benchmark, Golden Images And Replay Frames (Qt Gui, No Window)
+QT += core gui
+QT -= widgets
+CONFIG += console c++17 thread
+CONFIG -= app_bundle
+CONFIG += release
+
+TARGET = snakerender
+
+# Engine And Renderer Sources Are Shared With The Game
+INCLUDEPATH += ../..
+
+# Source Files To Be Compiled
+SOURCES += \
+    main.cpp \
+    ../../snakeautopilot.cpp \
+    ../../snakeengine.cpp \
+    ../../snakemap.cpp \
+    ../../snakemapfields.cpp \
+    ../../snakemcts.cpp \
+    ../../snakeparticles.cpp \
+    ../../snakerenderer.cpp \
+    ../../snakereplay.cpp \
+    ../../snakesprites.cpp \
+    ../../snakethreadpool.cpp
+
+# Header Files Containing Class Declarations
+HEADERS += \
+    ../../snakeautopilot.h \
+    ../../snakebits.h \
+    ../../snakebody.h \
+    ../../snakeengine.h \
+    ../../snakefreecells.h \
+    ../../snakemap.h \
+    ../../snakemapfields.h \
+    ../../snakemcts.h \
+    ../../snakeparticles.h \
+    ../../snakerandom.h \
+    ../../snakerenderer.h \
+    ../../snakereplay.h \
+    ../../snakesprites.h \
+    ../../snakethreadpool.h \
+    ../../snaketypes.h
@@ -0,0 +1,291 @@
+#include "snakeautopilot.h"
+#include "snakeengine.h"
+#include "snakethreadpool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// How A Simulated Game Ended
+enum DeathCause {
+    DiedWall,
+    DiedSelf,
+    Won,
+    Stalled,        // No Food Eaten For 4 * Cells Ticks
+    TickLimit,      // Reached --max-ticks
+    DeathCauseCount
+};
+
+const char *const DeathCauseNames[DeathCauseCount] = { "wall", "self", "won", "stalled", "tick_limit" };
+
+// Command Line Options
+struct Options
+{
+    int games = 1000;
+    int gridSize = 20;
+    int difficulty = -1;                // When Set, Overrides gridSize Like The Widget Does
+    int threads = 0;
+    SnakeAutopilotKind policy = SnakeAutopilotKind::AStar;
+    std::uint64_t seed = 1;
+    long long maxTicks = 0;             // 0 = Unlimited
+    int tickBucket = 100;
+    bool json = false;
+    const char *output = nullptr;
+};
+
+// Results Accumulated By One Worker, Merged Once The Batch Is Done
+struct Tally
+{
+    long long games = 0;
+    long long totalLength = 0;
+    long long totalTicks = 0;
+    long long causes[DeathCauseCount] = {};
+    std::vector<long long> lengthHistogram;     // Index = Final Length
+    std::vector<long long> tickHistogram;       // Index = Ticks Survived / tickBucket
+
+    void merge(const Tally &other)
+    {
+        games += other.games;
+        totalLength += other.totalLength;
+        totalTicks += other.totalTicks;
+        for (int i = 0; i < DeathCauseCount; ++i) {
+            causes[i] += other.causes[i];
+        }
+        addHistogram(lengthHistogram, other.lengthHistogram);
+        addHistogram(tickHistogram, other.tickHistogram);
+    }
+
+    static void addHistogram(std::vector<long long> &into, const std::vector<long long> &from)
+    {
+        if (into.size() < from.size()) into.resize(from.size(), 0);
+        for (size_t i = 0; i < from.size(); ++i) {
+            into[i] += from[i];
+        }
+    }
+
+    static void count(std::vector<long long> &histogram, size_t bucket)
+    {
+        if (histogram.size() <= bucket) histogram.resize(bucket + 1, 0);
+        ++histogram[bucket];
+    }
+};
+
+// Per-Worker State: Strategy Scratch Buffers Are Reused Across Games
+struct Worker
+{
+    std::unique_ptr<SnakeStrategy> strategy;
+    Tally tally;
+};
+
+/**
+ * @brief Grid Size The Widget Picks For A Difficulty On A Medium Screen
+ */
+int gridSizeForDifficulty(int difficulty)
+{
+    const int baseGridSize = 20;
+    switch (difficulty) {
+    case 0:  return baseGridSize - 3;
+    case 2:  return baseGridSize + 3;
+    default: return baseGridSize;
+    }
+}
+
+/**
+ * @brief Plays One Game To Its End And Records The Outcome
+ */
+void playGame(const Options &options, std::uint64_t seed, Worker &worker)
+{
+    SnakeEngine engine(options.gridSize, seed);
+    const long long stallLimit = 4LL * options.gridSize * options.gridSize;
+    long long sinceFood = 0;
+    DeathCause cause = Won;
+
+    while (true) {
+        SnakeStepResult result = engine.step(worker.strategy->decide(engine));
+        if (result == SnakeStepResult::HitWall) { cause = DiedWall; break; }
+        if (result == SnakeStepResult::HitSelf) { cause = DiedSelf; break; }
+        if (result == SnakeStepResult::Won) { cause = Won; break; }
+
+        sinceFood = result == SnakeStepResult::Ate ? 0 : sinceFood + 1;
+        if (sinceFood > stallLimit) { cause = Stalled; break; }
+        if (options.maxTicks > 0 && static_cast<long long>(engine.tickCount()) >= options.maxTicks) {
+            cause = TickLimit;
+            break;
+        }
+    }
+
+    Tally &tally = worker.tally;
+    ++tally.games;
+    tally.totalLength += engine.length();
+    tally.totalTicks += static_cast<long long>(engine.tickCount());
+    ++tally.causes[cause];
+    Tally::count(tally.lengthHistogram, engine.length());
+    Tally::count(tally.tickHistogram, engine.tickCount() / options.tickBucket);
+}
+
+/**
+ * @brief Writes Results As Rows Of section,key,value
+ */
+void writeCsv(std::FILE *out, const Options &options, const Tally &tally, const char *policyName)
+{
+    std::fprintf(out, "section,key,value\n");
+    std::fprintf(out, "config,policy,%s\n", policyName);
+    std::fprintf(out, "config,grid,%d\n", options.gridSize);
+    std::fprintf(out, "config,games,%d\n", options.games);
+    std::fprintf(out, "config,seed,%llu\n", static_cast<unsigned long long>(options.seed));
+    std::fprintf(out, "config,tick_bucket,%d\n", options.tickBucket);
+    std::fprintf(out, "summary,avg_length,%.3f\n", double(tally.totalLength) / std::max(1LL, tally.games));
+    std::fprintf(out, "summary,avg_ticks,%.3f\n", double(tally.totalTicks) / std::max(1LL, tally.games));
+    for (int i = 0; i < DeathCauseCount; ++i) {
+        std::fprintf(out, "death,%s,%lld\n", DeathCauseNames[i], tally.causes[i]);
+    }
+    for (size_t i = 0; i < tally.lengthHistogram.size(); ++i) {
+        if (tally.lengthHistogram[i]) std::fprintf(out, "length,%zu,%lld\n", i, tally.lengthHistogram[i]);
+    }
+    for (size_t i = 0; i < tally.tickHistogram.size(); ++i) {
+        if (tally.tickHistogram[i]) {
+            std::fprintf(out, "ticks,%zu,%lld\n", i * options.tickBucket, tally.tickHistogram[i]);
+        }
+    }
+}
+
+/**
+ * @brief Writes Non-Empty Histogram Buckets As A JSON Object Keyed By Bucket Start
+ */
+void writeJsonHistogram(std::FILE *out, const std::vector<long long> &histogram, int bucketWidth)
+{
+    std::fprintf(out, "{");
+    bool first = true;
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        if (!histogram[i]) continue;
+        std::fprintf(out, "%s\"%zu\": %lld", first ? "" : ", ", i * bucketWidth, histogram[i]);
+        first = false;
+    }
+    std::fprintf(out, "}");
+}
+
+/**
+ * @brief Writes Results As A Single JSON Document
+ */
+void writeJson(std::FILE *out, const Options &options, const Tally &tally, const char *policyName)
+{
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"config\": {\"policy\": \"%s\", \"grid\": %d, \"games\": %d, \"seed\": %llu, \"tick_bucket\": %d},\n",
+                 policyName, options.gridSize, options.games,
+                 static_cast<unsigned long long>(options.seed), options.tickBucket);
+    std::fprintf(out, "  \"summary\": {\"avg_length\": %.3f, \"avg_ticks\": %.3f},\n",
+                 double(tally.totalLength) / std::max(1LL, tally.games),
+                 double(tally.totalTicks) / std::max(1LL, tally.games));
+    std::fprintf(out, "  \"death\": {");
+    for (int i = 0; i < DeathCauseCount; ++i) {
+        std::fprintf(out, "%s\"%s\": %lld", i ? ", " : "", DeathCauseNames[i], tally.causes[i]);
+    }
+    std::fprintf(out, "},\n  \"length\": ");
+    writeJsonHistogram(out, tally.lengthHistogram, 1);
+    std::fprintf(out, ",\n  \"ticks\": ");
+    writeJsonHistogram(out, tally.tickHistogram, options.tickBucket);
+    std::fprintf(out, "\n}\n");
+}
+
+/**
+ * @brief Parses Command Line Flags
+ * @return false On An Unknown Flag Or Missing Value
+ */
+bool parseOptions(int argc, char *argv[], Options &options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char *flag = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp(flag, "--json") == 0) { options.json = true; continue; }
+        if (std::strcmp(flag, "--csv") == 0) { options.json = false; continue; }
+        if (!value) return false;
+        ++i;
+
+        if (std::strcmp(flag, "--games") == 0) options.games = std::max(1, std::atoi(value));
+        else if (std::strcmp(flag, "--grid") == 0) options.gridSize = std::max(3, std::atoi(value));
+        else if (std::strcmp(flag, "--difficulty") == 0) options.difficulty = std::atoi(value);
+        else if (std::strcmp(flag, "--threads") == 0) options.threads = std::max(0, std::atoi(value));
+        else if (std::strcmp(flag, "--seed") == 0) options.seed = std::strtoull(value, nullptr, 10);
+        else if (std::strcmp(flag, "--max-ticks") == 0) options.maxTicks = std::max(0LL, std::atoll(value));
+        else if (std::strcmp(flag, "--tick-bucket") == 0) options.tickBucket = std::max(1, std::atoi(value));
+        else if (std::strcmp(flag, "--output") == 0) options.output = value;
+        else if (std::strcmp(flag, "--policy") == 0) {
+            if (std::strcmp(value, "greedy") == 0) options.policy = SnakeAutopilotKind::GreedyBfs;
+            else if (std::strcmp(value, "astar") == 0) options.policy = SnakeAutopilotKind::AStar;
+            else if (std::strcmp(value, "hamiltonian") == 0) options.policy = SnakeAutopilotKind::Hamiltonian;
+            else if (std::strcmp(value, "mcts") == 0) options.policy = SnakeAutopilotKind::Mcts;
+            else return false;
+        }
+        else return false;
+    }
+
+    if (options.difficulty >= 0) {
+        options.gridSize = gridSizeForDifficulty(options.difficulty);
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief Batch Simulator Entry Point
+ *
+ * Usage: snakesim [--games N] [--grid N | --difficulty 0-2] [--policy greedy|astar|hamiltonian|mcts]
+ *                 [--threads N] [--seed N] [--max-ticks N] [--tick-bucket N]
+ *                 [--csv | --json] [--output FILE]
+ *
+ * Game i uses seed + i, so results do not depend on the thread count.
+ */
+int main(int argc, char *argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: snakesim [--games N] [--grid N | --difficulty 0-2] "
+                             "[--policy greedy|astar|hamiltonian|mcts] [--threads N] [--seed N] "
+                             "[--max-ticks N] [--tick-bucket N] [--csv | --json] [--output FILE]\n");
+        return 2;
+    }
+
+    SnakeThreadPool pool(options.threads);
+    std::vector<Worker> workers(pool.threadCount());
+    // Games Already Fill The Pool, So Each Worker's Strategy Searches On Its Own Thread Only.
+    // That Also Keeps MCTS Results Independent Of --threads And Of The Machine
+    for (Worker &worker : workers) {
+        worker.strategy = createSnakeStrategy(options.policy, 1);
+    }
+
+    Clock::time_point start = Clock::now();
+    pool.run(options.games, [&](int index, int worker) {
+        playGame(options, options.seed + static_cast<std::uint64_t>(index), workers[worker]);
+    });
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    Tally total;
+    for (const Worker &worker : workers) {
+        total.merge(worker.tally);
+    }
+
+    std::FILE *out = options.output ? std::fopen(options.output, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "snakesim: cannot open %s\n", options.output);
+        return 1;
+    }
+    const char *policyName = workers.front().strategy->name();
+    if (options.json) writeJson(out, options, total, policyName);
+    else writeCsv(out, options, total, policyName);
+    if (out != stdout) std::fclose(out);
+
+    std::fprintf(stderr, "%d games on %d threads in %.3f s (%.1f games/s, %.0f ticks/s)\n",
+                 options.games, pool.threadCount(), seconds, options.games / seconds,
+                 total.totalTicks / seconds);
+    return 0;
+}
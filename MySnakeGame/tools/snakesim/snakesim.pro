@@ -0,0 +1,33 @@
+# Headless Parallel Batch Simulator For Tuning Snake Difficulty (No Qt Required)
+CONFIG += console c++17 thread
+CONFIG -= qt app_bundle
+CONFIG += release
+
+TARGET = snakesim
+
+# Engine Sources Are Shared With The Game
+INCLUDEPATH += ../..
+
+# Source Files To Be Compiled
+SOURCES += \
+    main.cpp \
+    ../../snakeautopilot.cpp \
+    ../../snakeengine.cpp \
+    ../../snakemap.cpp \
+    ../../snakemapfields.cpp \
+    ../../snakemcts.cpp \
+    ../../snakethreadpool.cpp
+
+# Header Files Containing Class Declarations
+HEADERS += \
+    ../../snakeautopilot.h \
+    ../../snakebits.h \
+    ../../snakebody.h \
+    ../../snakeengine.h \
+    ../../snakefreecells.h \
+    ../../snakemap.h \
+    ../../snakemapfields.h \
+    ../../snakemcts.h \
+    ../../snakerandom.h \
+    ../../snakethreadpool.h \
+    ../../snaketypes.h